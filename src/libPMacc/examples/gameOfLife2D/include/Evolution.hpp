@@ -29,7 +29,7 @@
 #include "memory/dataTypes/Mask.hpp"
 
 #include "nvidia/rng/RNG.hpp"
-#include "nvidia/rng/methods/Xor.hpp"
+#include "nvidia/rng/methods/Philox.hpp"
 #include "nvidia/rng/distributions/Uniform_float.hpp"
 
 namespace gol
@@ -99,7 +99,7 @@ namespace gol
 
             /* get uniform random number from seed  */
             PMACC_AUTO(rng, nvidia::rng::create(
-                                nvidia::rng::methods::Xor(seed, cellIdx),
+                                nvidia::rng::methods::Philox(seed, cellIdx),
                                 nvidia::rng::distributions::Uniform_float()));
 
             /* write 1(white) if uniform random number 0<rng<1 is smaller than 'fraction' */
@@ -32,6 +32,9 @@
 #include "dataManagement/DataConnector.hpp"
 #include "pluginSystem/PluginConnector.hpp"
 #include "nvidia/memory/MemoryInfo.hpp"
+#include "mpi/CommunicatorRegistry.hpp"
+#include "mpi/ReduceBatcher.hpp"
+#include "communication/ExchangeAggregator.hpp"
 #include "mappings/simulation/Filesystem.hpp"
 
 
@@ -107,15 +110,30 @@ namespace PMacc
             return PMacc::Filesystem<DIM>::getInstance();
         }
 
+        mpi::CommunicatorRegistry& CommunicatorRegistry()
+        {
+            return mpi::CommunicatorRegistry::getInstance();
+        }
+
+        mpi::ReduceBatcher& ReduceBatcher()
+        {
+            return mpi::ReduceBatcher::getInstance();
+        }
+
+        PMacc::ExchangeAggregator& ExchangeAggregator()
+        {
+            return PMacc::ExchangeAggregator::getInstance();
+        }
+
         static Environment<DIM>& get()
         {
             static Environment<DIM> instance;
             return instance;
         }
 
-        void initDevices(DataSpace<DIM> devices, DataSpace<DIM> periodic)
+        void initDevices(DataSpace<DIM> devices, DataSpace<DIM> periodic, bool nodeBlockPlacement = false)
         {
-            PMacc::GridController<DIM>::getInstance().init(devices, periodic);
+            PMacc::GridController<DIM>::getInstance().init(devices, periodic, nodeBlockPlacement);
 
             PMacc::Filesystem<DIM>::getInstance();
 
@@ -141,8 +159,15 @@ namespace PMacc
 
         }
 
+        /** release resources which depend on MPI
+         *
+         * must be called before MPI_Finalize
+         */
         void finalize()
         {
+            PMacc::ExchangeAggregator::getInstance().finalize();
+            mpi::CommunicatorRegistry::getInstance().finalize();
+            PMacc::GridController<DIM>::getInstance().getCommunicator().finalize();
         }
 
     private:
@@ -204,3 +229,4 @@ namespace PMacc
 }
 
 #include "particles/tasks/ParticleFactory.tpp"
+#include "communication/ExchangeAggregator.tpp"
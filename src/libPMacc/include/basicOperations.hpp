@@ -56,6 +56,45 @@ DINLINE void atomicAddWrapper(double* inAddress, double value)
                                                                                    old)))) != 0.0);
 }
 
+/** atomicInc for 32 bit and 64 bit unsigned integers
+ *
+ * (old >= limit) ? 0 : (old + 1), there is no native 64 bit atomicInc
+ *
+ * @return old value
+ */
+DINLINE uint32_t atomicIncWrapper(uint32_t* address, uint32_t limit)
+{
+    return atomicInc(address, limit);
+}
+
+DINLINE uint64_cu atomicIncWrapper(uint64_cu* address, uint64_cu limit)
+{
+    uint64_cu old = *address;
+    uint64_cu assumed;
+    do
+    {
+        assumed = old;
+        old = atomicCAS(address, assumed, assumed >= limit ? 0 : assumed + 1);
+    }
+    while (assumed != old);
+    return old;
+}
+
+/** atomicSub for 32 bit and 64 bit unsigned integers
+ *
+ * @return old value
+ */
+DINLINE uint32_t atomicSubWrapper(uint32_t* address, uint32_t value)
+{
+    return atomicSub(address, value);
+}
+
+DINLINE uint64_cu atomicSubWrapper(uint64_cu* address, uint64_cu value)
+{
+    /* two's complement, there is no native 64 bit atomicSub */
+    return atomicAdd(address, (uint64_cu) 0 - value);
+}
+
 }
 
 } //namespace PMacc
@@ -47,7 +47,7 @@ public:
 
     /*! ctor
      */
-    CommunicatorMPI() : hostRank(0)
+    CommunicatorMPI() : hostRank(0), topologyGroup(MPI_GROUP_NULL), nodeGroup(MPI_GROUP_NULL)
     {
         //MPI_Init(NULL, NULL);
     }
@@ -86,10 +86,13 @@ public:
      *
      * @param nodes number of GPU nodes in each dimension
      * @param periodic specifying whether the grid is periodic (1) or not (0) in each dimension
+     * @param nodeBlockPlacement place blocks of neighboring grid positions on
+     *                           the same node (@see createNodeBlockComm)
      *
      * \warning throws invalid argument if cx*cy*cz != totalnodes
      */
-    void init(DataSpace<DIM3> numberProcesses, DataSpace<DIM3> periodic) throw (std::invalid_argument)
+    void init(DataSpace<DIM3> numberProcesses, DataSpace<DIM3> periodic,
+              bool nodeBlockPlacement = false) throw (std::invalid_argument)
     {
         this->periodic = periodic;
 
@@ -117,9 +120,27 @@ public:
 
         int periods[] = {periodic.x(), periodic.y(), periodic.z()};
 
+        /* the rank order of computing_comm defines the position in the grid */
+        if (nodeBlockPlacement)
+            computing_comm = createNodeBlockComm();
+
         /*create new communicator based on cartesian coordinates*/
         MPI_CHECK(MPI_Cart_create(computing_comm, DIM, dims, periods, 0, &topology));
 
+        if (computing_comm != MPI_COMM_WORLD)
+            MPI_CHECK(MPI_Comm_free(&computing_comm));
+
+        /* aggregated messages get their own context, their tags can never
+         * match a message of startSend/startReceive */
+        MPI_CHECK(MPI_Comm_dup(topology, &aggregationTopology));
+
+        /* remember the ranks on this node to classify neighbors */
+        MPI_Comm nodeComm;
+        MPI_CHECK(MPI_Comm_split_type(topology, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &nodeComm));
+        MPI_CHECK(MPI_Comm_group(nodeComm, &nodeGroup));
+        MPI_CHECK(MPI_Comm_group(topology, &topologyGroup));
+        MPI_CHECK(MPI_Comm_free(&nodeComm));
+
         // 3. update Host rank
         hostRank = UpdateHostRank();
 
@@ -146,6 +167,21 @@ public:
         return communicationMask;
     }
 
+    /*! returns true if the neighbor in direction ex runs on the same node
+     *
+     * @param ex exchange type (e.g. RIGHT)
+     * @return false if there is no neighbor or it runs on an other node
+     */
+    bool isNeighborOnSameNode(uint32_t ex) const
+    {
+        int rank = ranks[ex];
+        if (rank == -1)
+            return false;
+        int nodeLocalRank;
+        MPI_CHECK(MPI_Group_translate_ranks(topologyGroup, 1, &rank, nodeGroup, &nodeLocalRank));
+        return nodeLocalRank != MPI_UNDEFINED;
+    }
+
     /*! returns coordinate of this process in (via init) created grid
      *
      * Coordinates are between [0-cx, 0-cy, 0-cz]
@@ -195,6 +231,42 @@ public:
 
     // description in ICommunicator
 
+    MPI_Request* startSendAggregated(uint32_t ex, const char *send_data, size_t send_data_count, uint32_t tag)
+    {
+        MPI_Request *request = new MPI_Request;
+
+        MPI_CHECK(MPI_Isend(
+                            (void*) send_data,
+                            send_data_count,
+                            MPI_CHAR,
+                            ExchangeTypeToRank(ex),
+                            gridExchangeTag + tag,
+                            aggregationTopology,
+                            request));
+
+        return request;
+    }
+
+    // description in ICommunicator
+
+    MPI_Request* startReceiveAggregated(uint32_t ex, char *recv_data, size_t recv_data_max, uint32_t tag)
+    {
+        MPI_Request *request = new MPI_Request;
+
+        MPI_CHECK(MPI_Irecv(
+                            recv_data,
+                            recv_data_max,
+                            MPI_CHAR,
+                            ExchangeTypeToRank(ex),
+                            gridExchangeTag + tag,
+                            aggregationTopology,
+                            request));
+
+        return request;
+    }
+
+    // description in ICommunicator
+
     bool slide()
     {
         // MPI_Barrier(topology);
@@ -223,6 +295,18 @@ public:
         return result;
     }
 
+    /*! free the MPI groups of this communicator
+     *
+     * must be called before MPI_Finalize
+     */
+    void finalize()
+    {
+        if (nodeGroup != MPI_GROUP_NULL)
+            MPI_CHECK(MPI_Group_free(&nodeGroup));
+        if (topologyGroup != MPI_GROUP_NULL)
+            MPI_CHECK(MPI_Group_free(&topologyGroup));
+    }
+
 
 protected:
 
@@ -231,6 +315,10 @@ protected:
      */
     void exit()
     {
+        int isFinalized = 0;
+        MPI_CHECK(MPI_Finalized(&isFinalized));
+        if (!isFinalized)
+            finalize();
         // MPI_CHECK(MPI_Barrier(MPI_COMM_WORLD));
      //   MPI_Finalize();
     }
@@ -308,6 +396,118 @@ protected:
 
     }
 
+    /*! create a communicator whose rank order places node blocks
+     *
+     * All nodes must have the same number of ranks n. The grid is tiled with
+     * blocks of n positions (e.g. 2x2x2 for 8 ranks per node) which have the
+     * smallest surface to other nodes, every node gets one block.
+     * The rank in the returned communicator is the cartesian rank.
+     * If no block fits (uneven nodes, n does not divide the grid)
+     * MPI_COMM_WORLD is returned and the default order is used.
+     */
+    MPI_Comm createNodeBlockComm()
+    {
+        int worldRank;
+        MPI_CHECK(MPI_Comm_rank(MPI_COMM_WORLD, &worldRank));
+
+        MPI_Comm nodeComm;
+        MPI_CHECK(MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, worldRank,
+                                      MPI_INFO_NULL, &nodeComm));
+        int nodeRank;
+        int nodeSize;
+        MPI_CHECK(MPI_Comm_rank(nodeComm, &nodeRank));
+        MPI_CHECK(MPI_Comm_size(nodeComm, &nodeSize));
+
+        /* number the nodes by the order of their first rank */
+        MPI_Comm leaderComm;
+        MPI_CHECK(MPI_Comm_split(MPI_COMM_WORLD, nodeRank == 0 ? 0 : MPI_UNDEFINED, worldRank, &leaderComm));
+        int nodeIndex = 0;
+        if (leaderComm != MPI_COMM_NULL)
+        {
+            MPI_CHECK(MPI_Comm_rank(leaderComm, &nodeIndex));
+            MPI_CHECK(MPI_Comm_free(&leaderComm));
+        }
+        MPI_CHECK(MPI_Bcast(&nodeIndex, 1, MPI_INT, 0, nodeComm));
+        MPI_CHECK(MPI_Comm_free(&nodeComm));
+
+        int sizeRange[2] = {nodeSize, -nodeSize};
+        int globalSizeRange[2];
+        MPI_CHECK(MPI_Allreduce(sizeRange, globalSizeRange, 2, MPI_INT, MPI_MAX, MPI_COMM_WORLD));
+
+        int block[3];
+        if (globalSizeRange[0] != -globalSizeRange[1] || !findNodeBlock(nodeSize, block))
+        {
+            if (worldRank == 0)
+                log<ggLog::MPI > ("node block placement not possible for %1% ranks per node, use default order") %
+                    nodeSize;
+            return MPI_COMM_WORLD;
+        }
+
+        /* cartesian coordinate: block of the node + position in the block,
+         * MPI cartesian ranks are row-major (last dimension is the fastest) */
+        int blockCoord[3];
+        int localCoord[3];
+        int nodeRest = nodeIndex;
+        int localRest = nodeRank;
+        for (int d = 2; d >= 0; --d)
+        {
+            const int numBlocks = dims[d] / block[d];
+            blockCoord[d] = nodeRest % numBlocks;
+            nodeRest /= numBlocks;
+            localCoord[d] = localRest % block[d];
+            localRest /= block[d];
+        }
+        int cartRank = 0;
+        for (int d = 0; d < 3; ++d)
+            cartRank = cartRank * dims[d] + blockCoord[d] * block[d] + localCoord[d];
+
+        if (worldRank == 0)
+            log<ggLog::MPI > ("node block placement: %1%x%2%x%3% devices per node") %
+                block[0] % block[1] % block[2];
+
+        MPI_Comm comm;
+        MPI_CHECK(MPI_Comm_split(MPI_COMM_WORLD, 0, cartRank, &comm));
+        return comm;
+    }
+
+    /*! find the block of n grid positions with the smallest surface
+     *
+     * Only faces to other blocks count, a block which spans a whole
+     * dimension has no inter-node faces in this dimension.
+     *
+     * @return false if no block of n positions tiles the grid
+     */
+    bool findNodeBlock(int n, int* block) const
+    {
+        bool found = false;
+        int bestSurface = 0;
+        for (int bx = 1; bx <= dims[0]; ++bx)
+            for (int by = 1; by <= dims[1]; ++by)
+            {
+                if (dims[0] % bx != 0 || dims[1] % by != 0 || n % (bx * by) != 0)
+                    continue;
+                const int bz = n / (bx * by);
+                if (bz > dims[2] || dims[2] % bz != 0)
+                    continue;
+
+                const int b[3] = {bx, by, bz};
+                int surface = 0;
+                for (int d = 0; d < 3; ++d)
+                    if (b[d] != dims[d])
+                        surface += 2 * n / b[d];
+
+                if (!found || surface < bestSurface)
+                {
+                    found = true;
+                    bestSurface = surface;
+                    block[0] = bx;
+                    block[1] = by;
+                    block[2] = bz;
+                }
+            }
+        return found;
+    }
+
     /*! update coordinates \see getCoordinates
      */
     void updateCoordinates()
@@ -402,6 +602,8 @@ private:
     DataSpace<DIM3> periodic;
     //! MPI communicator (currently MPI_COMM_WORLD)
     MPI_Comm topology;
+    //! duplicate of topology for aggregated messages \see startSendAggregated
+    MPI_Comm aggregationTopology;
     //! array for exchangetype-to-rank conversen \see ExchangeTypeToRank
     int ranks[27];
     //! size of PMacc [cx,cy,cz]
@@ -412,6 +614,9 @@ private:
     int hostRank;
     //! offset for sliding window
     int yoffset;
+    //! all ranks of topology and the ranks on this node \see isNeighborOnSameNode
+    MPI_Group topologyGroup;
+    MPI_Group nodeGroup;
 
     int mpiRank;
     int mpiSize;
@@ -0,0 +1,234 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of libPMacc.
+ *
+ * libPMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libPMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with libPMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <mpi.h>
+#include <vector>
+
+#include "types.h"
+
+namespace PMacc
+{
+
+/** message which carries the payloads of several exchanges to one neighbor
+ *
+ * Wire format: Header, numEntries DirectoryEntry, payloads in the order of
+ * the directory (every payload starts at a multiple of 8 byte).
+ */
+struct AggregatedMessage
+{
+
+    struct Header
+    {
+        uint32_t numEntries;
+        uint32_t reserved;
+    };
+
+    struct DirectoryEntry
+    {
+        uint32_t tag;
+        uint32_t reserved;
+        uint64_t bytes;
+    };
+
+    /** one exchange within the message */
+    struct Entry
+    {
+        /* communication tag of the exchange */
+        uint32_t tag;
+        /* send: payload on the host, receive: destination on the host */
+        char* data;
+        /* send: payload size, receive: received size */
+        size_t bytes;
+        /* receive: capacity of data */
+        size_t maxBytes;
+    };
+
+    bool isSend;
+    uint32_t exchange;
+    /* no more entries can be added */
+    bool closed;
+    /* MPI operation is finished (and a received message is unpacked) */
+    bool finished;
+    uint32_t numReady;
+    uint32_t numReleased;
+    std::vector<Entry> entries;
+    std::vector<char> buffer;
+    MPI_Request* request;
+
+    static size_t alignPayload(size_t bytes)
+    {
+        return (bytes + 7) & ~size_t(7);
+    }
+};
+
+/** handle of one exchange within an aggregated message */
+struct ExchangeSlot
+{
+
+    ExchangeSlot() : message(NULL), index(0)
+    {
+    }
+
+    ExchangeSlot(AggregatedMessage* message, uint32_t index) : message(message), index(index)
+    {
+    }
+
+    /** false if the exchange is sent with an own message */
+    bool isValid() const
+    {
+        return message != NULL;
+    }
+
+    AggregatedMessage* message;
+    uint32_t index;
+};
+
+/** collect all exchanges of one communication phase per neighbor
+ *
+ * Every exchange which is added to a phase is sent (received) as part of
+ * one message per neighbor instead of an own message. The message to a
+ * neighbor is sent if the phase is closed and the payloads of all its
+ * exchanges are on the host.
+ *
+ * All ranks must add the exchanges in the same order, the message tag is
+ * the tag of the first exchange of a neighbor.
+ *
+ * MPI_Ineighbor_alltoallv is not used: it can only start if the payloads
+ * of all neighbors are on the host and finishes for all neighbors at once,
+ * here every neighbor message is sent and unpacked as soon as it is ready.
+ * The neighbor collectives of a Cartesian communicator also know only the
+ * face neighbors, edges and corners would need a graph communicator.
+ */
+class ExchangePhase
+{
+public:
+
+    ExchangePhase();
+
+    /** closes the phase if close() was not called */
+    ~ExchangePhase();
+
+    /** add an exchange which is sent to neighbor ex
+     *
+     * @param ex direction of the neighbor
+     * @param tag communication tag of the exchange
+     * @return slot for ExchangeAggregator::setSendData/testSend
+     */
+    ExchangeSlot addSend(uint32_t ex, uint32_t tag);
+
+    /** add an exchange which is received from neighbor ex
+     *
+     * @param ex direction of the neighbor
+     * @param tag communication tag of the exchange
+     * @param maxBytes capacity of the receive buffer
+     * @return slot for ExchangeAggregator::setReceiveBuffer/testReceive
+     */
+    ExchangeSlot addReceive(uint32_t ex, uint32_t tag, size_t maxBytes);
+
+    /** no more exchanges are added, start the messages */
+    void close();
+
+private:
+
+    ExchangePhase(const ExchangePhase&);
+
+    ExchangePhase& operator=(const ExchangePhase&);
+
+    AggregatedMessage* sendMessages[27];
+    AggregatedMessage* receiveMessages[27];
+};
+
+/** packs, sends and unpacks the messages of all ExchangePhases
+ *
+ * Messages are owned by the aggregator and reused after all slots of a
+ * message were released (a test method returned true).
+ */
+class ExchangeAggregator
+{
+public:
+
+    static ExchangeAggregator& getInstance()
+    {
+        static ExchangeAggregator instance;
+        return instance;
+    }
+
+    /** payload of a send slot is ready on the host
+     *
+     * data must be valid until testSend(slot) returns true
+     */
+    void setSendData(const ExchangeSlot& slot, const char* data, size_t bytes);
+
+    /** set the host buffer where the payload of a receive slot is unpacked
+     *
+     * must be called before the phase of the slot is closed
+     */
+    void setReceiveBuffer(const ExchangeSlot& slot, char* data);
+
+    /** test if the message of a send slot is sent
+     *
+     * @return true if finished, the slot is released and must not be used again
+     */
+    bool testSend(const ExchangeSlot& slot);
+
+    /** test if the payload of a receive slot is unpacked
+     *
+     * @param receivedBytes size of the received payload (set if finished)
+     * @return true if finished, the slot is released and must not be used again
+     */
+    bool testReceive(const ExchangeSlot& slot, size_t& receivedBytes);
+
+    /** log statistics and free the message pool */
+    void finalize();
+
+private:
+
+    friend class ExchangePhase;
+
+    ExchangeAggregator() : numMessages(0), numPayloads(0)
+    {
+    }
+
+    ExchangeAggregator(const ExchangeAggregator&);
+
+    ExchangeAggregator& operator=(const ExchangeAggregator&);
+
+    AggregatedMessage* getMessage(bool isSend, uint32_t ex);
+
+    void close(AggregatedMessage& message);
+
+    void startSend(AggregatedMessage& message);
+
+    bool test(AggregatedMessage& message);
+
+    void unpack(AggregatedMessage& message, int receivedBytes);
+
+    void release(AggregatedMessage& message);
+
+    std::vector<AggregatedMessage*> freeMessages;
+    uint64_t numMessages;
+    uint64_t numPayloads;
+};
+
+} //namespace PMacc
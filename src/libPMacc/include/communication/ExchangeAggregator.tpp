@@ -0,0 +1,286 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of libPMacc.
+ *
+ * libPMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libPMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with libPMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+#include <stdexcept>
+
+#include "communication/ExchangeAggregator.hpp"
+#include "communication/manager_common.h"
+#include "Environment.hpp"
+
+namespace PMacc
+{
+
+inline ExchangePhase::ExchangePhase()
+{
+    for (uint32_t i = 0; i < 27; ++i)
+    {
+        sendMessages[i] = NULL;
+        receiveMessages[i] = NULL;
+    }
+}
+
+inline ExchangePhase::~ExchangePhase()
+{
+    close();
+}
+
+inline ExchangeSlot ExchangePhase::addSend(uint32_t ex, uint32_t tag)
+{
+    if (sendMessages[ex] == NULL)
+        sendMessages[ex] = ExchangeAggregator::getInstance().getMessage(true, ex);
+
+    AggregatedMessage::Entry entry;
+    entry.tag = tag;
+    entry.data = NULL;
+    entry.bytes = 0;
+    entry.maxBytes = 0;
+    sendMessages[ex]->entries.push_back(entry);
+
+    return ExchangeSlot(sendMessages[ex], sendMessages[ex]->entries.size() - 1);
+}
+
+inline ExchangeSlot ExchangePhase::addReceive(uint32_t ex, uint32_t tag, size_t maxBytes)
+{
+    if (receiveMessages[ex] == NULL)
+        receiveMessages[ex] = ExchangeAggregator::getInstance().getMessage(false, ex);
+
+    AggregatedMessage::Entry entry;
+    entry.tag = tag;
+    entry.data = NULL;
+    entry.bytes = 0;
+    entry.maxBytes = maxBytes;
+    receiveMessages[ex]->entries.push_back(entry);
+
+    return ExchangeSlot(receiveMessages[ex], receiveMessages[ex]->entries.size() - 1);
+}
+
+inline void ExchangePhase::close()
+{
+    ExchangeAggregator& aggregator = ExchangeAggregator::getInstance();
+    for (uint32_t i = 0; i < 27; ++i)
+    {
+        /* post the receives first, the neighbors may already send */
+        if (receiveMessages[i] != NULL)
+            aggregator.close(*receiveMessages[i]);
+        receiveMessages[i] = NULL;
+    }
+    for (uint32_t i = 0; i < 27; ++i)
+    {
+        if (sendMessages[i] != NULL)
+            aggregator.close(*sendMessages[i]);
+        sendMessages[i] = NULL;
+    }
+}
+
+inline void ExchangeAggregator::setSendData(const ExchangeSlot& slot, const char* data, size_t bytes)
+{
+    AggregatedMessage& message = *(slot.message);
+    AggregatedMessage::Entry& entry = message.entries[slot.index];
+    entry.data = (char*) data;
+    entry.bytes = bytes;
+    ++message.numReady;
+
+    if (message.closed && message.numReady == message.entries.size())
+        startSend(message);
+}
+
+inline void ExchangeAggregator::setReceiveBuffer(const ExchangeSlot& slot, char* data)
+{
+    slot.message->entries[slot.index].data = data;
+}
+
+inline bool ExchangeAggregator::testSend(const ExchangeSlot& slot)
+{
+    AggregatedMessage& message = *(slot.message);
+    if (!test(message))
+        return false;
+
+    release(message);
+    return true;
+}
+
+inline bool ExchangeAggregator::testReceive(const ExchangeSlot& slot, size_t& receivedBytes)
+{
+    AggregatedMessage& message = *(slot.message);
+    if (!test(message))
+        return false;
+
+    receivedBytes = message.entries[slot.index].bytes;
+    release(message);
+    return true;
+}
+
+inline void ExchangeAggregator::finalize()
+{
+    if (numMessages != 0)
+    {
+        log<ggLog::COMMUNICATION > ("ExchangeAggregator: %1% exchanges sent with %2% messages") %
+            numPayloads % numMessages;
+    }
+
+    for (size_t i = 0; i < freeMessages.size(); ++i)
+        delete freeMessages[i];
+    freeMessages.clear();
+}
+
+inline AggregatedMessage* ExchangeAggregator::getMessage(bool isSend, uint32_t ex)
+{
+    AggregatedMessage* message;
+    if (freeMessages.empty())
+        message = new AggregatedMessage;
+    else
+    {
+        message = freeMessages.back();
+        freeMessages.pop_back();
+    }
+
+    message->isSend = isSend;
+    message->exchange = ex;
+    message->closed = false;
+    message->finished = false;
+    message->numReady = 0;
+    message->numReleased = 0;
+    message->entries.clear();
+    message->request = NULL;
+    return message;
+}
+
+inline void ExchangeAggregator::close(AggregatedMessage& message)
+{
+    message.closed = true;
+
+    if (message.isSend)
+    {
+        if (message.numReady == message.entries.size())
+            startSend(message);
+        return;
+    }
+
+    size_t maxBytes = sizeof (AggregatedMessage::Header) +
+        message.entries.size() * sizeof (AggregatedMessage::DirectoryEntry);
+    for (size_t i = 0; i < message.entries.size(); ++i)
+        maxBytes += AggregatedMessage::alignPayload(message.entries[i].maxBytes);
+    message.buffer.resize(maxBytes);
+
+    message.request = Environment<>::get().EnvironmentController().getCommunicator().
+        startReceiveAggregated(message.exchange, &(message.buffer[0]), maxBytes,
+                               message.entries[0].tag);
+}
+
+inline void ExchangeAggregator::startSend(AggregatedMessage& message)
+{
+    const size_t numEntries = message.entries.size();
+    const size_t directoryBytes = sizeof (AggregatedMessage::Header) +
+        numEntries * sizeof (AggregatedMessage::DirectoryEntry);
+
+    size_t bytes = directoryBytes;
+    for (size_t i = 0; i < numEntries; ++i)
+        bytes += AggregatedMessage::alignPayload(message.entries[i].bytes);
+    message.buffer.resize(bytes);
+
+    char* buffer = &(message.buffer[0]);
+    AggregatedMessage::Header* header = (AggregatedMessage::Header*) buffer;
+    header->numEntries = numEntries;
+    header->reserved = 0;
+
+    AggregatedMessage::DirectoryEntry* directory = (AggregatedMessage::DirectoryEntry*) (header + 1);
+    size_t offset = directoryBytes;
+    for (size_t i = 0; i < numEntries; ++i)
+    {
+        const AggregatedMessage::Entry& entry = message.entries[i];
+        directory[i].tag = entry.tag;
+        directory[i].reserved = 0;
+        directory[i].bytes = entry.bytes;
+        if (entry.bytes != 0)
+            memcpy(buffer + offset, entry.data, entry.bytes);
+        offset += AggregatedMessage::alignPayload(entry.bytes);
+    }
+
+    message.request = Environment<>::get().EnvironmentController().getCommunicator().
+        startSendAggregated(message.exchange, buffer, bytes, message.entries[0].tag);
+
+    ++numMessages;
+    numPayloads += numEntries;
+}
+
+inline bool ExchangeAggregator::test(AggregatedMessage& message)
+{
+    if (message.finished)
+        return true;
+    /* send message waits for payloads */
+    if (message.request == NULL)
+        return false;
+
+    int flag = 0;
+    MPI_Status status;
+    MPI_CHECK(MPI_Test(message.request, &flag, &status));
+    if (!flag)
+        return false;
+
+    delete message.request;
+    message.request = NULL;
+
+    if (!message.isSend)
+    {
+        int receivedBytes;
+        MPI_CHECK(MPI_Get_count(&status, MPI_CHAR, &receivedBytes));
+        unpack(message, receivedBytes);
+    }
+    message.finished = true;
+    return true;
+}
+
+inline void ExchangeAggregator::unpack(AggregatedMessage& message, int receivedBytes)
+{
+    const size_t numEntries = message.entries.size();
+    const size_t directoryBytes = sizeof (AggregatedMessage::Header) +
+        numEntries * sizeof (AggregatedMessage::DirectoryEntry);
+
+    const char* buffer = &(message.buffer[0]);
+    const AggregatedMessage::Header* header = (const AggregatedMessage::Header*) buffer;
+    if ((size_t) receivedBytes < directoryBytes || header->numEntries != numEntries)
+        throw std::runtime_error("aggregated message does not match the received exchanges");
+
+    const AggregatedMessage::DirectoryEntry* directory = (const AggregatedMessage::DirectoryEntry*) (header + 1);
+    size_t offset = directoryBytes;
+    for (size_t i = 0; i < numEntries; ++i)
+    {
+        AggregatedMessage::Entry& entry = message.entries[i];
+        if (directory[i].tag != entry.tag || directory[i].bytes > entry.maxBytes)
+            throw std::runtime_error("aggregated message does not match the received exchanges");
+
+        entry.bytes = directory[i].bytes;
+        if (entry.bytes != 0)
+            memcpy(entry.data, buffer + offset, entry.bytes);
+        offset += AggregatedMessage::alignPayload(entry.bytes);
+    }
+}
+
+inline void ExchangeAggregator::release(AggregatedMessage& message)
+{
+    ++message.numReleased;
+    if (message.numReleased == message.entries.size())
+        freeMessages.push_back(&message);
+}
+
+} //namespace PMacc
@@ -77,6 +77,19 @@ public:
      */
     virtual MPI_Request* startReceive(uint32_t ex, char *recv_data, size_t recv_data_max, uint32_t tag) = 0;
 
+    /*! starts sending an aggregated message via MPI (non-blocking)
+     *
+     * same as startSend, but aggregated messages use an own channel and
+     * never match a message of startSend/startReceive (\see ExchangeAggregator)
+     */
+    virtual MPI_Request* startSendAggregated(uint32_t ex, const char *send_data, size_t send_data_count, uint32_t tag) = 0;
+
+    /*! starts receiving an aggregated message via MPI (non-blocking)
+     *
+     * counterpart of startSendAggregated, \see startReceive
+     */
+    virtual MPI_Request* startReceiveAggregated(uint32_t ex, char *recv_data, size_t recv_data_max, uint32_t tag) = 0;
+
     virtual int getRank()=0;
 
 };
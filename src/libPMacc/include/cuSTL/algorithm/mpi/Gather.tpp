@@ -24,6 +24,7 @@
 #include <iostream>
 #include "cuSTL/container/copier/Memcopy.hpp"
 #include "communication/manager_common.h"
+#include "dimensions/DataSpaceOperations.hpp"
 
 namespace PMacc
 {
@@ -37,44 +38,28 @@ Gather<dim>::Gather(const zone::SphericZone<dim>& _zone) : comm(MPI_COMM_NULL)
 {
     using namespace PMacc::math;
 
-    PMacc::GridController<dim>& con = PMacc::Environment<dim>::get().GridController();
-    Int<dim> pos = con.getPosition();
+    /* shared with all other algorithms on the same zone */
+    this->comm = Environment<dim>::get().CommunicatorRegistry().getZone(_zone);
+    this->m_participate = (this->comm != MPI_COMM_NULL);
 
-    int numWorldRanks; MPI_Comm_size(MPI_COMM_WORLD, &numWorldRanks);
-    std::vector<Int<dim> > allPositions(numWorldRanks);
-
-    MPI_CHECK(MPI_Allgather((void*)&pos, sizeof(Int<dim>), MPI_CHAR,
-                  (void*)allPositions.data(), sizeof(Int<dim>), MPI_CHAR,
-                  MPI_COMM_WORLD));
-
-    std::vector<int> new_ranks;
-    int myWorldId; MPI_Comm_rank(MPI_COMM_WORLD, &myWorldId);
-
-    this->m_participate = false;
-    for(int i = 0; i < (int)allPositions.size(); i++)
+    /* ranks in comm are ordered by their linear position (x fastest),
+     * so the positions follow from the zone without communication */
+    const DataSpace<dim> zoneSize(_zone.size);
+    const int numPositions = zoneSize.productOfComponents();
+    for(int i = 0; i < numPositions; i++)
     {
-        Int<dim> pos = allPositions[i];
-        if(!_zone.within(pos)) continue;
-
-        new_ranks.push_back(i);
-        this->positions.push_back(allPositions[i]);
-        if(i == myWorldId) this->m_participate = true;
+        const DataSpace<dim> inZone = DataSpaceOperations<dim>::map(zoneSize, i);
+        Int<dim> pos;
+        for(int d = 0; d < dim; d++)
+            pos[d] = _zone.offset[d] + inZone[d];
+        this->positions.push_back(pos);
     }
-    MPI_Group world_group, new_group;
-
-    MPI_CHECK(MPI_Comm_group(MPI_COMM_WORLD, &world_group));
-    MPI_CHECK(MPI_Group_incl(world_group, new_ranks.size(), new_ranks.data(), &new_group));
-    MPI_CHECK(MPI_Comm_create(MPI_COMM_WORLD, new_group, &this->comm));
-    MPI_CHECK(MPI_Group_free(&new_group));
 }
 
 template<int dim>
 Gather<dim>::~Gather()
 {
-    if(this->comm != MPI_COMM_NULL)
-    {
-        MPI_CHECK(MPI_Comm_free(&this->comm));
-    }
+    /* the communicator is owned by the CommunicatorRegistry */
 }
 
 template<int dim>
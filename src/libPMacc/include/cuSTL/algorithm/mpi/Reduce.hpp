@@ -54,6 +54,8 @@ class Reduce
 {
 private:
     MPI_Comm comm;
+    /* rank of the root in comm */
+    int rootRank;
     bool m_participate;
 public:
     /** constructor
@@ -36,57 +36,24 @@ namespace mpi
 {
 
 template<int dim>
-Reduce<dim>::Reduce(const zone::SphericZone<dim>& _zone, bool setThisAsRoot) : comm(MPI_COMM_NULL)
+Reduce<dim>::Reduce(const zone::SphericZone<dim>& _zone, bool setThisAsRoot) : comm(MPI_COMM_NULL), rootRank(0)
 {
-    using namespace math;
-      
-    PMACC_AUTO(&con,Environment<dim>::get().GridController());
-    
-    typedef std::pair<Int<dim>, bool> PosFlag;
-    PosFlag posFlag;
-    posFlag.first = (Int<dim>)con.getPosition();
-    posFlag.second = setThisAsRoot;
-    
-    int numWorldRanks; MPI_Comm_size(MPI_COMM_WORLD, &numWorldRanks);
-    std::vector<PosFlag> allPositionsFlags(numWorldRanks);
-    
-    MPI_CHECK(MPI_Allgather((void*)&posFlag, sizeof(PosFlag), MPI_CHAR,
-                  (void*)allPositionsFlags.data(), sizeof(PosFlag), MPI_CHAR,
-                  MPI_COMM_WORLD));
-                  
-    std::vector<int> new_ranks;
-    int myWorldId; MPI_Comm_rank(MPI_COMM_WORLD, &myWorldId);
-    
-    this->m_participate = false;
-    for(int i = 0; i < (int)allPositionsFlags.size(); i++)
-    {
-        Int<dim> pos = allPositionsFlags[i].first;
-        bool flag = allPositionsFlags[i].second;
-        if(!_zone.within(pos)) continue;
-        
-        new_ranks.push_back(i);
-        //if rank i is supposed to be the new root put him at the front
-        if(flag) std::swap(new_ranks.front(), new_ranks.back());
-        if(i == myWorldId) this->m_participate = true;
-    }
-    
-    MPI_Group world_group = MPI_GROUP_NULL;
-    MPI_Group new_group = MPI_GROUP_NULL;
+    /* shared with all other algorithms on the same zone */
+    this->comm = Environment<dim>::get().CommunicatorRegistry().getZone(_zone);
+    this->m_participate = (this->comm != MPI_COMM_NULL);
+    if(!this->m_participate) return;
 
-    MPI_CHECK(MPI_Comm_group(MPI_COMM_WORLD, &world_group));
-    MPI_CHECK(MPI_Group_incl(world_group, new_ranks.size(), &(new_ranks.front()), &new_group));
-    MPI_CHECK(MPI_Comm_create(MPI_COMM_WORLD, new_group, &this->comm));
-    MPI_CHECK(MPI_Group_free(&new_group));
-    MPI_CHECK(MPI_Group_free(&world_group));
+    /* the root is chosen per reduce, only the communicator is shared */
+    int myId; MPI_Comm_rank(this->comm, &myId);
+    int rootCandidate = setThisAsRoot ? myId : -1;
+    MPI_CHECK(MPI_Allreduce(&rootCandidate, &this->rootRank, 1, MPI_INT, MPI_MAX, this->comm));
+    if(this->rootRank < 0) this->rootRank = 0;
 }
 
 template<int dim>
 Reduce<dim>::~Reduce()
 {
-    if(this->comm != MPI_COMM_NULL)
-    {
-        MPI_CHECK(MPI_Comm_free(&this->comm));
-    }
+    /* the communicator is owned by the CommunicatorRegistry */
 }
 
 template<int dim>
@@ -98,7 +65,7 @@ bool Reduce<dim>::root() const
         return false;
     }
     int myId; MPI_Comm_rank(this->comm, &myId);
-    return myId == 0;
+    return myId == this->rootRank;
 }
 
 template<int dim>
@@ -150,7 +117,7 @@ void Reduce<dim>::operator()
     MPI_CHECK(MPI_Op_create(&detail::MPI_User_Op<Functor, Type>::callback, 1, &user_op));
     
     MPI_CHECK(MPI_Reduce(&(*src.origin()), &(*dest.origin()), sizeof(Type) * dest.size().productOfComponents(),
-        MPI_CHAR, user_op, 0, this->comm));
+        MPI_CHAR, user_op, this->rootRank, this->comm));
     
     MPI_CHECK(MPI_Op_free(&user_op));
 }
@@ -25,6 +25,7 @@
 
 #include "math/vector/Size_t.hpp"
 #include "cuSTL/cursor/BufferCursor.hpp"
+#include "memory/MemoryAccounting.hpp"
 #include "tag.h"
 
 namespace PMacc
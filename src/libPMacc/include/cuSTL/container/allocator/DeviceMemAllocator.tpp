@@ -44,6 +44,8 @@ DeviceMemAllocator<Type, _dim>::allocate(const math::Size_t<_dim>& size)
         cudaData.xsize = size[0];
         cudaData.ysize = size[1];
         CUDA_CHECK_NO_EXCEP(cudaMallocPitch(&cudaData.ptr, &cudaData.pitch, cudaData.xsize * sizeof (Type), cudaData.ysize));
+        MemoryAccounting::getInstance().allocate(cudaData.ptr, MemoryAccounting::DEVICE,
+                                                 cudaData.pitch * cudaData.ysize);
         pitch[0] = cudaData.pitch;
     }
     else if (dim == 3u)
@@ -53,6 +55,8 @@ DeviceMemAllocator<Type, _dim>::allocate(const math::Size_t<_dim>& size)
         extent.height = size[1];
         extent.depth = size[2];
         CUDA_CHECK_NO_EXCEP(cudaMalloc3D(&cudaData, extent));
+        MemoryAccounting::getInstance().allocate(cudaData.ptr, MemoryAccounting::DEVICE,
+                                                 cudaData.pitch * extent.height * extent.depth);
         pitch[0] = cudaData.pitch;
         pitch[1] = cudaData.pitch * size[1];
     }
@@ -76,6 +80,7 @@ DeviceMemAllocator<Type, 1>::allocate(const math::Size_t<1>& size)
     Type* dataPointer;
 
     CUDA_CHECK_NO_EXCEP(cudaMalloc((void**)&dataPointer, size[0] * sizeof(Type)));
+    MemoryAccounting::getInstance().allocate(dataPointer, MemoryAccounting::DEVICE, size[0] * sizeof(Type));
 
     return cursor::BufferCursor<Type, 1>(dataPointer, math::Size_t<0>());
 #endif
@@ -91,6 +96,7 @@ template<typename TCursor>
 void DeviceMemAllocator<Type, _dim>::deallocate(const TCursor& cursor)
 {
 #ifndef __CUDA_ARCH__
+    MemoryAccounting::getInstance().release(cursor.getMarker());
     CUDA_CHECK_NO_EXCEP(cudaFree(cursor.getMarker()));
 #endif
 }
@@ -100,6 +106,7 @@ template<typename TCursor>
 void DeviceMemAllocator<Type, 1>::deallocate(const TCursor& cursor)
 {
 #ifndef __CUDA_ARCH__
+    MemoryAccounting::getInstance().release(cursor.getMarker());
     CUDA_CHECK_NO_EXCEP(cudaFree(cursor.getMarker()));
 #endif
 }
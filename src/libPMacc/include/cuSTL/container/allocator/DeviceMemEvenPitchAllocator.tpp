@@ -33,6 +33,8 @@ DeviceMemEvenPitch<Type, _dim>::allocate(const math::Size_t<_dim>& size)
     math::Size_t<_dim-1> pitch;
 
     CUDA_CHECK(cudaMalloc((void**)&dataPointer, sizeof(Type) * size.productOfComponents()));
+    MemoryAccounting::getInstance().allocate(dataPointer, MemoryAccounting::DEVICE,
+                                             sizeof(Type) * size.productOfComponents());
 
     if (dim == 2u)
     {
@@ -54,6 +56,7 @@ DeviceMemEvenPitch<Type, 1>::allocate(const math::Size_t<1>& size)
     Type* dataPointer;
 
     CUDA_CHECK(cudaMalloc((void**)&dataPointer, size[0] * sizeof(Type)));
+    MemoryAccounting::getInstance().allocate(dataPointer, MemoryAccounting::DEVICE, size[0] * sizeof(Type));
 
     return cursor::BufferCursor<Type, 1>(dataPointer, math::Size_t<0>());
 }
@@ -62,6 +65,7 @@ template<typename Type, int _dim>
 template<typename TCursor>
 void DeviceMemEvenPitch<Type, _dim>::deallocate(const TCursor& cursor)
 {
+    MemoryAccounting::getInstance().release(cursor.getMarker());
     CUDA_CHECK(cudaFree(cursor.getMarker()));
 }
 
@@ -69,6 +73,7 @@ template<typename Type>
 template<typename TCursor>
 void DeviceMemEvenPitch<Type, 1>::deallocate(const TCursor& cursor)
 {
+    MemoryAccounting::getInstance().release(cursor.getMarker());
     CUDA_CHECK(cudaFree(cursor.getMarker()));
 }
 
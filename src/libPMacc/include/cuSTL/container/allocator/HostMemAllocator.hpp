@@ -26,6 +26,7 @@
 #include <stdint.h>
 #include "math/vector/Size_t.hpp"
 #include "cuSTL/cursor/BufferCursor.hpp"
+#include "memory/MemoryAccounting.hpp"
 #include "tag.h"
 
 namespace PMacc
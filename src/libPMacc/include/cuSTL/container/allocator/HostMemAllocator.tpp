@@ -34,6 +34,8 @@ HostMemAllocator<Type, _dim>::allocate(const math::Size_t<_dim>& size)
     math::Size_t<_dim-1> pitch;
 
     CUDA_CHECK_NO_EXCEP(cudaMallocHost((void**)&dataPointer, sizeof(Type) * size.productOfComponents()));
+    MemoryAccounting::getInstance().allocate(dataPointer, MemoryAccounting::HOST,
+                                             sizeof(Type) * size.productOfComponents());
     if(dim == 2u)
     {
         pitch[0] = size[0] * sizeof(Type);
@@ -63,6 +65,8 @@ HostMemAllocator<Type, 1>::allocate(const math::Size_t<1>& size)
     math::Size_t<0> pitch;
 
     CUDA_CHECK_NO_EXCEP(cudaMallocHost((void**)&dataPointer, sizeof(Type) * size.productOfComponents()));
+    MemoryAccounting::getInstance().allocate(dataPointer, MemoryAccounting::HOST,
+                                             sizeof(Type) * size.productOfComponents());
 
     return cursor::BufferCursor<Type, 1>(dataPointer, pitch);
 #endif
@@ -79,6 +83,7 @@ template<typename TCursor>
 void HostMemAllocator<Type, _dim>::deallocate(const TCursor& cursor)
 {
 #ifndef __CUDA_ARCH__
+    MemoryAccounting::getInstance().release(cursor.getMarker());
     CUDA_CHECK_NO_EXCEP(cudaFreeHost(cursor.getMarker()));
 #endif
 }
@@ -88,6 +93,7 @@ template<typename TCursor>
 void HostMemAllocator<Type, 1>::deallocate(const TCursor& cursor)
 {
 #ifndef __CUDA_ARCH__
+    MemoryAccounting::getInstance().release(cursor.getMarker());
     CUDA_CHECK_NO_EXCEP(cudaFreeHost(cursor.getMarker()));
 #endif
 }
@@ -171,6 +171,40 @@ namespace PMacc
             return (TYPE&) (dataset->getData());
         }
 
+        /**
+         * Returns registered data and synchronizes only a region of it.
+         *
+         * Same as getData(id) but only the region is transferred to the host.
+         * Repeated requests for (parts of) already synchronized regions in the
+         * same simulation step do not transfer data again.
+         *
+         * @tparam TYPE if of the data to load
+         * @tparam DIM dimension of the region
+         * @param id id of the Dataset to load from
+         * @param region region to synchronize (for fields including guarding cells)
+         * @return returns a reference to the data of type TYPE
+         */
+        template<class TYPE, unsigned DIM>
+        TYPE &getData(SimulationDataId id, const Selection<DIM>& region)
+        {
+            std::map<SimulationDataId, Dataset*>::const_iterator iter = datasets.mapping.find(id);
+
+            if (iter == datasets.mapping.end())
+                throw std::runtime_error(getExceptionStringForID("Invalid DataConnector dataset ID", id));
+
+            Selection<DIM3> region3D;
+            for (uint32_t d = 0; d < DIM3; ++d)
+            {
+                region3D.offset[d] = d < DIM ? region.offset[d] : 0;
+                region3D.size[d] = d < DIM ? region.size[d] : 1;
+            }
+
+            Dataset * dataset = iter->second;
+            dataset->synchronize(region3D);
+
+            return (TYPE&) (dataset->getData());
+        }
+
         /**
          * Decrements the reference counter to the data specified by id.
          *
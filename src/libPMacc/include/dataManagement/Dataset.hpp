@@ -25,6 +25,7 @@
 #define	DATASET_HPP
 
 #include <cassert>
+#include <vector>
 
 #include "dataManagement/ISimulationData.hpp"
 
@@ -94,6 +95,29 @@ namespace PMacc
             }
         }
 
+        /**
+         * Synchronizes a region of the stored data if necessary.
+         *
+         * Regions which are already synchronized since the last
+         * invalidate() are served from the host copy.
+         *
+         * @param region region to synchronize (\see ISimulationData::synchronizeRegion)
+         */
+        void synchronize(const Selection<DIM3>& region)
+        {
+            if (status == AUTO_OK)
+                return;
+
+            for (size_t i = 0; i < syncedRegions.size(); ++i)
+            {
+                if (contains(syncedRegions[i], region))
+                    return;
+            }
+
+            data.synchronizeRegion(region);
+            syncedRegions.push_back(region);
+        }
+
         /**
          * Invalidates data synchronization status.
          */
@@ -101,10 +125,25 @@ namespace PMacc
         {
             if (this->status == AUTO_OK)
                 this->status = AUTO_INVALID;
+            syncedRegions.clear();
         }
     private:
+
+        static bool contains(const Selection<DIM3>& outer, const Selection<DIM3>& inner)
+        {
+            for (uint32_t d = 0; d < DIM3; ++d)
+            {
+                if (inner.offset[d] < outer.offset[d] ||
+                    inner.offset[d] + inner.size[d] > outer.offset[d] + outer.size[d])
+                    return false;
+            }
+            return true;
+        }
+
         ISimulationData &data;
         DatasetStatus status;
+        /* regions synchronized since the last invalidate() */
+        std::vector<Selection<DIM3> > syncedRegions;
     };
 }
 
@@ -25,6 +25,9 @@
 
 #include <string>
 
+#include "types.h"
+#include "mappings/simulation/Selection.hpp"
+
 namespace PMacc
 {
     typedef std::string SimulationDataId;
@@ -41,6 +44,21 @@ namespace PMacc
          * will return up-to-date values.
          */
         virtual void synchronize() = 0;
+
+        /**
+         * Synchronizes only a region of the simulation data.
+         *
+         * The region is given in the index space of the data
+         * (for fields including the guarding cells), unused
+         * dimensions have offset 0 and size 1.
+         * The default implementation synchronizes all data.
+         *
+         * @param region region which must be up-to-date on the host
+         */
+        virtual void synchronizeRegion(const Selection<DIM3>& region)
+        {
+            synchronize();
+        }
         
         /**
          * Return the globally unique identifier for this simulation data.
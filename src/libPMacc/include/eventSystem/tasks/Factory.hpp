@@ -39,8 +39,13 @@ namespace PMacc
     template <class TYPE, unsigned DIM>
     class Exchange;
 
+    template <class TYPE, unsigned DIM, class BORDERTYPE>
+    class GridBuffer;
+
     class TaskKernel;
 
+    struct ExchangeSlot;
+
     /**
      * Singleton Factory-pattern class for creation of several types of EventTasks.
      * Tasks are not actually 'returned' but immediately initialised and
@@ -71,6 +76,21 @@ namespace PMacc
         HostBuffer<TYPE, DIM>& dst,
         ITask *registeringTask = NULL);
 
+        /**
+         * creates a TaskCopyDeviceToHost which copies only a region
+         * @param src DeviceBuffer to copy data from
+         * @param dst HostBuffer to copy data to
+         * @param regionOffset offset of the region (equal in both buffers)
+         * @param regionSize size of the region
+         * @param registeringTask optional pointer to an ITask which should be registered at the new task as an observer
+         */
+        template <class TYPE, unsigned DIM>
+        EventTask createTaskCopyDeviceToHost(DeviceBuffer<TYPE, DIM>& src,
+        HostBuffer<TYPE, DIM>& dst,
+        const DataSpace<DIM>& regionOffset,
+        const DataSpace<DIM>& regionSize,
+        ITask *registeringTask = NULL);
+
         /**
          * creates a TaskCopyDeviceToDevice
          * @param src DeviceBuffer to copy data from
@@ -84,21 +104,31 @@ namespace PMacc
         /**
          * Creates a TaskReceive.
          * @param ex Exchange to create new TaskReceive with
-         * @param task_out returns the newly created task
+         * @param slot slot of an aggregated message, invalid to receive an own message
          * @param registeringTask optional pointer to an ITask which should be registered at the new task as an observer
          */
         template <class TYPE, unsigned DIM>
-        EventTask createTaskReceive(Exchange<TYPE, DIM> &ex,
+        EventTask createTaskReceive(Exchange<TYPE, DIM> &ex, const ExchangeSlot &slot,
         ITask *registeringTask = NULL);
 
         /**
          * Creates a TaskSend.
          * @param ex Exchange to create new TaskSend with
-         * @param task_in TaskReceive to register at new TaskSend
+         * @param copyEvent returns the event of the copy to the host
+         * @param slot slot of an aggregated message, invalid to send an own message
          * @param registeringTask optional pointer to an ITask which should be registered at the new task as an observer
          */
         template <class TYPE, unsigned DIM>
-        EventTask createTaskSend(Exchange<TYPE, DIM> &ex, EventTask &copyEvent,
+        EventTask createTaskSend(Exchange<TYPE, DIM> &ex, EventTask &copyEvent, const ExchangeSlot &slot,
+        ITask *registeringTask = NULL);
+
+        /**
+         * Creates a TaskStagedCommunication.
+         * @param buffer GridBuffer with staged exchanges
+         * @param registeringTask optional pointer to an ITask which should be registered at the new task as an observer
+         */
+        template <class TYPE, unsigned DIM, class BORDERTYPE>
+        EventTask createTaskStagedCommunication(GridBuffer<TYPE, DIM, BORDERTYPE> &buffer,
         ITask *registeringTask = NULL);
 
         /**
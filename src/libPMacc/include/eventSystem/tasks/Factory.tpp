@@ -37,6 +37,7 @@
 #include "eventSystem/tasks/TaskSetCurrentSizeOnDevice.hpp"
 #include "eventSystem/tasks/TaskSendMPI.hpp"
 #include "eventSystem/tasks/TaskReceiveMPI.hpp"
+#include "eventSystem/tasks/TaskStagedCommunication.hpp"
 #include "eventSystem/streams/EventStream.hpp"
 #include "eventSystem/streams/StreamController.hpp"
 #include "eventSystem/tasks/TaskGetCurrentSizeFromDevice.hpp"
@@ -76,6 +77,26 @@ namespace PMacc
         return startTask(*task, registeringTask);
     }
 
+    /**
+     * creates a TaskCopyDeviceToHost for a region
+     * @param src DeviceBuffer to copy data from
+     * @param dst HostBuffer to copy data to
+     * @param regionOffset offset of the region (equal in both buffers)
+     * @param regionSize size of the region
+     * @param registeringTask optional pointer to an ITask which should be registered at the new task as an observer
+     */
+    template <class TYPE, unsigned DIM>
+    inline EventTask Factory::createTaskCopyDeviceToHost(DeviceBuffer<TYPE, DIM>& src,
+    HostBuffer<TYPE, DIM>& dst,
+    const DataSpace<DIM>& regionOffset,
+    const DataSpace<DIM>& regionSize,
+    ITask *registeringTask)
+    {
+        TaskCopyDeviceToHost<TYPE, DIM>* task = new TaskCopyDeviceToHost<TYPE, DIM > (src, dst, regionOffset, regionSize);
+
+        return startTask(*task, registeringTask);
+    }
+
     /**
      * creates a TaskCopyDeviceToDevice
      * @param src DeviceBuffer to copy data from
@@ -94,14 +115,14 @@ namespace PMacc
     /**
      * Creates a TaskReceive.
      * @param ex Exchange to create new TaskReceive with
-     * @param task_out returns the newly created task
+     * @param slot slot of an aggregated message, invalid to receive an own message
      * @param registeringTask optional pointer to an ITask which should be registered at the new task as an observer
      */
     template <class TYPE, unsigned DIM>
-    inline EventTask Factory::createTaskReceive(Exchange<TYPE, DIM> &ex,
+    inline EventTask Factory::createTaskReceive(Exchange<TYPE, DIM> &ex, const ExchangeSlot &slot,
     ITask *registeringTask)
     {
-        TaskReceive<TYPE, DIM>* task = new TaskReceive<TYPE, DIM > (ex);
+        TaskReceive<TYPE, DIM>* task = new TaskReceive<TYPE, DIM > (ex, slot);
 
         return startTask(*task, registeringTask);
     }
@@ -109,14 +130,30 @@ namespace PMacc
     /**
      * Creates a TaskSend.
      * @param ex Exchange to create new TaskSend with
-     * @param task_in TaskReceive to register at new TaskSend
+     * @param copyEvent returns the event of the copy to the host
+     * @param slot slot of an aggregated message, invalid to send an own message
      * @param registeringTask optional pointer to an ITask which should be registered at the new task as an observer
      */
     template <class TYPE, unsigned DIM>
-    inline EventTask Factory::createTaskSend(Exchange<TYPE, DIM> &ex, EventTask &copyEvent,
+    inline EventTask Factory::createTaskSend(Exchange<TYPE, DIM> &ex, EventTask &copyEvent, const ExchangeSlot &slot,
+    ITask *registeringTask)
+    {
+        TaskSend<TYPE, DIM>* task = new TaskSend<TYPE, DIM > (ex, copyEvent, slot);
+
+        return startTask(*task, registeringTask);
+    }
+
+    /**
+     * Creates a TaskStagedCommunication.
+     * @param buffer GridBuffer with staged exchanges
+     * @param registeringTask optional pointer to an ITask which should be registered at the new task as an observer
+     */
+    template <class TYPE, unsigned DIM, class BORDERTYPE>
+    inline EventTask Factory::createTaskStagedCommunication(GridBuffer<TYPE, DIM, BORDERTYPE> &buffer,
     ITask *registeringTask)
     {
-        TaskSend<TYPE, DIM>* task = new TaskSend<TYPE, DIM > (ex, copyEvent);
+        TaskStagedCommunication<TYPE, DIM, BORDERTYPE>* task =
+            new TaskStagedCommunication<TYPE, DIM, BORDERTYPE > (buffer);
 
         return startTask(*task, registeringTask);
     }
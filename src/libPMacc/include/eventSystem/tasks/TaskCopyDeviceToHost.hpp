@@ -45,8 +45,18 @@ namespace PMacc
     {
     public:
 
-        TaskCopyDeviceToHostBase( DeviceBuffer<TYPE, DIM>& src, HostBuffer<TYPE, DIM>& dst) :
-        StreamTask()
+        /**
+         * @param src device buffer to copy from
+         * @param dst host buffer to copy to
+         * @param regionOffset offset of the region to copy (only used if regionSize is not empty)
+         * @param regionSize size of the region to copy, empty (default) copies the current size
+         */
+        TaskCopyDeviceToHostBase( DeviceBuffer<TYPE, DIM>& src, HostBuffer<TYPE, DIM>& dst,
+                                  const DataSpace<DIM>& regionOffset = DataSpace<DIM>(),
+                                  const DataSpace<DIM>& regionSize = DataSpace<DIM>()) :
+        StreamTask(),
+        regionOffset(regionOffset),
+        regionSize(regionSize)
         {
             this->host =  & dst;
             this->device =  & src;
@@ -75,6 +85,13 @@ namespace PMacc
         virtual void init()
         {
            // __startAtomicTransaction( __getTransactionEvent());
+            if (regionSize.productOfComponents() != 0)
+            {
+                /* region copies never change the current size of the host buffer */
+                copyRegion();
+                this->activate();
+                return;
+            }
             size_t current_size = device->getCurrentSize();
             host->setCurrentSize(current_size);
             DataSpace<DIM> devCurrentSize = device->getCurrentDataSpace(current_size);
@@ -91,6 +108,10 @@ namespace PMacc
 
         virtual void copy(DataSpace<DIM> &devCurrentSize) = 0;
 
+        /** copy regionSize elements starting at regionOffset,
+         *  the region has the same position in host and device buffer */
+        virtual void copyRegion() = 0;
+
         void fastCopy(TYPE* src,TYPE* dst,  size_t size)
         {
             CUDA_CHECK(cudaMemcpyAsync(dst,
@@ -103,6 +124,8 @@ namespace PMacc
 
         HostBuffer<TYPE, DIM> *host;
         DeviceBuffer<TYPE, DIM> *device;
+        DataSpace<DIM> regionOffset;
+        DataSpace<DIM> regionSize;
     };
 
     template <class TYPE, unsigned DIM>
@@ -113,8 +136,10 @@ namespace PMacc
     {
     public:
 
-        TaskCopyDeviceToHost( DeviceBuffer<TYPE, DIM1>& src, HostBuffer<TYPE, DIM1>& dst) :
-        TaskCopyDeviceToHostBase<TYPE, DIM1>(src, dst)
+        TaskCopyDeviceToHost( DeviceBuffer<TYPE, DIM1>& src, HostBuffer<TYPE, DIM1>& dst,
+                              const DataSpace<DIM1>& regionOffset = DataSpace<DIM1>(),
+                              const DataSpace<DIM1>& regionSize = DataSpace<DIM1>()) :
+        TaskCopyDeviceToHostBase<TYPE, DIM1>(src, dst, regionOffset, regionSize)
         {
         }
 
@@ -132,6 +157,13 @@ namespace PMacc
 
         }
 
+        virtual void copyRegion()
+        {
+            this->fastCopy(this->device->getPointer() + this->regionOffset[0],
+                           this->host->getBasePointer() + this->regionOffset[0],
+                           this->regionSize[0]);
+        }
+
     };
 
     template <class TYPE>
@@ -139,8 +171,10 @@ namespace PMacc
     {
     public:
 
-        TaskCopyDeviceToHost(DeviceBuffer<TYPE, DIM2>& src, HostBuffer<TYPE, DIM2>& dst) :
-        TaskCopyDeviceToHostBase<TYPE, DIM2>(src, dst)
+        TaskCopyDeviceToHost(DeviceBuffer<TYPE, DIM2>& src, HostBuffer<TYPE, DIM2>& dst,
+                             const DataSpace<DIM2>& regionOffset = DataSpace<DIM2>(),
+                             const DataSpace<DIM2>& regionSize = DataSpace<DIM2>()) :
+        TaskCopyDeviceToHostBase<TYPE, DIM2>(src, dst, regionOffset, regionSize)
         {
         }
 
@@ -159,6 +193,25 @@ namespace PMacc
 
         }
 
+        virtual void copyRegion()
+        {
+            const size_t hostPitch = this->host->getDataSpace()[0] * sizeof (TYPE);
+            const size_t devicePitch = this->device->getPitch();
+            char* hostPtr = (char*) this->host->getBasePointer() +
+                this->regionOffset[1] * hostPitch + this->regionOffset[0] * sizeof (TYPE);
+            char* devicePtr = (char*) this->device->getPointer() +
+                this->regionOffset[1] * devicePitch + this->regionOffset[0] * sizeof (TYPE);
+
+            CUDA_CHECK(cudaMemcpy2DAsync(hostPtr,
+                                         hostPitch,
+                                         devicePtr,
+                                         devicePitch,
+                                         this->regionSize[0] * sizeof (TYPE),
+                                         this->regionSize[1],
+                                         cudaMemcpyDeviceToHost,
+                                         this->getCudaStream()));
+        }
+
     };
 
     template <class TYPE>
@@ -166,8 +219,10 @@ namespace PMacc
     {
     public:
 
-        TaskCopyDeviceToHost( DeviceBuffer<TYPE, DIM3>& src, HostBuffer<TYPE, DIM3>& dst) :
-        TaskCopyDeviceToHostBase<TYPE, DIM3>(src, dst)
+        TaskCopyDeviceToHost( DeviceBuffer<TYPE, DIM3>& src, HostBuffer<TYPE, DIM3>& dst,
+                              const DataSpace<DIM3>& regionOffset = DataSpace<DIM3>(),
+                              const DataSpace<DIM3>& regionSize = DataSpace<DIM3>()) :
+        TaskCopyDeviceToHostBase<TYPE, DIM3>(src, dst, regionOffset, regionSize)
         {
         }
 
@@ -202,6 +257,36 @@ namespace PMacc
 
         }
 
+        virtual void copyRegion()
+        {
+            cudaPitchedPtr hostPtr;
+            hostPtr.pitch = this->host->getDataSpace()[0] * sizeof (TYPE);
+            hostPtr.ptr = this->host->getBasePointer();
+            hostPtr.xsize = this->host->getDataSpace()[0] * sizeof (TYPE);
+            hostPtr.ysize = this->host->getDataSpace()[1];
+
+            cudaMemcpy3DParms params;
+            params.srcArray = NULL;
+            params.srcPos = make_cudaPos((this->device->getOffset()[0] + this->regionOffset[0]) * sizeof (TYPE),
+                                         this->device->getOffset()[1] + this->regionOffset[1],
+                                         this->device->getOffset()[2] + this->regionOffset[2]);
+            params.srcPtr = this->device->getCudaPitched();
+
+            params.dstArray = NULL;
+            params.dstPos = make_cudaPos(this->regionOffset[0] * sizeof (TYPE),
+                                         this->regionOffset[1],
+                                         this->regionOffset[2]);
+            params.dstPtr = hostPtr;
+
+            params.extent = make_cudaExtent(
+                                            this->regionSize[0] * sizeof (TYPE),
+                                            this->regionSize[1],
+                                            this->regionSize[2]);
+            params.kind = cudaMemcpyDeviceToHost;
+
+            CUDA_CHECK(cudaMemcpy3DAsync(&params, this->getCudaStream()));
+        }
+
     };
 
 } //namespace PMacc
@@ -31,18 +31,26 @@
 #include "eventSystem/tasks/TaskCopyHostToDevice.hpp"
 #include "eventSystem/events/EventDataReceive.hpp"
 #include "eventSystem/tasks/Factory.hpp"
+#include "communication/ExchangeAggregator.hpp"
 
 namespace PMacc
 {
 
 
+    /**
+     * Receives an exchange and copies it to the device.
+     *
+     * If the task has a valid ExchangeSlot the payload is unpacked from
+     * an aggregated message (see ExchangePhase) instead of an own message.
+     */
     template <class TYPE, unsigned DIM>
     class TaskReceive : public MPITask
     {
     public:
 
-        TaskReceive(Exchange<TYPE, DIM> &ex) :
+        TaskReceive(Exchange<TYPE, DIM> &ex, const ExchangeSlot& slot) :
         exchange(&ex),
+        slot(slot),
         state(Constructor)
         {
         }
@@ -50,7 +58,16 @@ namespace PMacc
         virtual void init()
         {
             state = WaitForReceived;
-            Environment<>::get().Factory().createTaskReceiveMPI(exchange, this);
+            if (slot.isValid())
+            {
+                __startAtomicTransaction();
+                Environment<>::get().ExchangeAggregator().setReceiveBuffer(
+                                                                          slot,
+                                                                          (char*) exchange->getHostBuffer().getBasePointer());
+                __endTransaction();
+            }
+            else
+                Environment<>::get().Factory().createTaskReceiveMPI(exchange, this);
         }
 
         bool executeIntern()
@@ -58,6 +75,16 @@ namespace PMacc
             switch (state)
             {
                 case WaitForReceived:
+                    if (slot.isValid())
+                    {
+                        size_t receivedBytes;
+                        if (Environment<>::get().ExchangeAggregator().testReceive(slot, receivedBytes))
+                        {
+                            newBufferSize = receivedBytes / sizeof (TYPE);
+                            state = RunCopy;
+                            return executeIntern();
+                        }
+                    }
                     break;
                 case RunCopy:
                     state = WaitForFinish;
@@ -141,6 +168,7 @@ namespace PMacc
 
 
         Exchange<TYPE, DIM> *exchange;
+        ExchangeSlot slot;
         state_t state;
         size_t newBufferSize;
     };
@@ -34,20 +34,28 @@
 #include "eventSystem/tasks/TaskCopyDeviceToHost.hpp"
 #include "mappings/simulation/EnvironmentController.hpp"
 #include "eventSystem/tasks/Factory.hpp"
+#include "communication/ExchangeAggregator.hpp"
 
 namespace PMacc
 {
 
 
 
+    /**
+     * Copies an exchange to the host and sends it.
+     *
+     * If the task has a valid ExchangeSlot the payload is sent as part of
+     * an aggregated message (see ExchangePhase) instead of an own message.
+     */
     template <class TYPE, unsigned DIM>
     class TaskSend : public MPITask
     {
     public:
 
-        TaskSend(Exchange<TYPE, DIM> &ex, EventTask& copyEvent) :
+        TaskSend(Exchange<TYPE, DIM> &ex, EventTask& copyEvent, const ExchangeSlot& slot) :
         exchange(&ex),
         copyEvent(copyEvent),
+        slot(slot),
         state(Constructor)
         {
         }
@@ -84,10 +92,21 @@ namespace PMacc
                 case DeviceToHostFinished:
                     state = SendDone;
                     __startTransaction();
-                    Environment<>::get().Factory().createTaskSendMPI(exchange, this);
+                    if (slot.isValid())
+                        Environment<>::get().ExchangeAggregator().setSendData(
+                                                                             slot,
+                                                                             (char*) exchange->getHostBuffer().getPointer(),
+                                                                             exchange->getHostBuffer().getCurrentSize() * sizeof (TYPE));
+                    else
+                        Environment<>::get().Factory().createTaskSendMPI(exchange, this);
                     __endTransaction(); //we need no blocking because we get a singnal if transaction is finished
                     break;
                 case SendDone:
+                    if (slot.isValid() && Environment<>::get().ExchangeAggregator().testSend(slot))
+                    {
+                        state = Finish;
+                        return true;
+                    }
                     break;
                 case Finish:
                     return true;
@@ -138,6 +157,7 @@ namespace PMacc
 
         Exchange<TYPE, DIM> *exchange;
         EventTask& copyEvent;
+        ExchangeSlot slot;
         state_t state;
     };
 
@@ -0,0 +1,139 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of libPMacc.
+ *
+ * libPMacc is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libPMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with libPMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "eventSystem/tasks/MPITask.hpp"
+#include "eventSystem/tasks/Factory.hpp"
+#include "memory/dataTypes/Mask.hpp"
+
+namespace PMacc
+{
+
+template <class TYPE, unsigned DIM, class BORDERTYPE>
+class GridBuffer;
+
+/**
+ * Exchanges the guards of a GridBuffer with staged exchanges
+ * (\see GridBuffer::addStagedExchange).
+ *
+ * Stage d sends and receives the two faces of dimension d and starts
+ * after all guards of stage d-1 are received, because the borders of
+ * stage d include the guards of the previous stages.
+ */
+template <class TYPE, unsigned DIM, class BORDERTYPE>
+class TaskStagedCommunication : public MPITask
+{
+public:
+
+    TaskStagedCommunication(GridBuffer<TYPE, DIM, BORDERTYPE> &buffer) :
+    buffer(buffer),
+    stage(0),
+    state(Constructor)
+    {
+    }
+
+    virtual void init()
+    {
+        startStage(__getTransactionEvent());
+        state = WaitForStage;
+    }
+
+    bool executeIntern()
+    {
+        switch (state)
+        {
+        case WaitForStage:
+            if (!isFinished(receiveEvent))
+                break;
+            if (++stage < DIM)
+                startStage(EventTask());
+            else
+                state = WaitForSend;
+            break;
+        case WaitForSend:
+            /* host buffers of the last send are in use until the copies finished */
+            return isFinished(copyEvent);
+        default:
+            return false;
+        }
+
+        return false;
+    }
+
+    virtual ~TaskStagedCommunication()
+    {
+        notify(this->myId, RECVFINISHED, NULL);
+    }
+
+    void event(id_t, EventType, IEventData*)
+    {
+    }
+
+    std::string toString()
+    {
+        return "TaskStagedCommunication";
+    }
+
+private:
+
+    enum state_t
+    {
+        Constructor,
+        WaitForStage,
+        WaitForSend
+    };
+
+    bool isFinished(EventTask &ev)
+    {
+        return NULL == Environment<>::get().Manager().getITaskIfNotFinished(ev.getTaskId());
+    }
+
+    /* start send and receive of both faces of dimension stage */
+    void startStage(EventTask serialEvent)
+    {
+        /* RIGHT, BOTTOM or BACK */
+        uint32_t positiveFace = 1;
+        for (uint32_t d = 0; d < stage; ++d)
+            positiveFace *= 3;
+        const uint32_t faces[2] = {positiveFace, 2 * positiveFace};
+
+        receiveEvent = EventTask();
+        for (uint32_t f = 0; f < 2; ++f)
+        {
+            const uint32_t recvEx = faces[f];
+            receiveEvent += buffer.asyncReceive(serialEvent, recvEx);
+
+            EventTask copy;
+            buffer.asyncSend(serialEvent, Mask::getMirroredExchangeType(recvEx), copy);
+            copyEvent += copy;
+        }
+    }
+
+    GridBuffer<TYPE, DIM, BORDERTYPE> &buffer;
+    uint32_t stage;
+    state_t state;
+    EventTask receiveEvent;
+    EventTask copyEvent;
+};
+
+} //namespace PMacc
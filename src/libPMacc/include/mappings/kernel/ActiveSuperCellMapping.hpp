@@ -0,0 +1,194 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of libPMacc.
+ *
+ * libPMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libPMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with libPMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+#include "dimensions/DataSpace.hpp"
+#include "dimensions/DataSpaceOperations.hpp"
+#include "mappings/kernel/AreaMappingMethods.hpp"
+
+#include <algorithm>
+
+namespace PMacc
+{
+
+/** device list of the supercells of CORE and BORDER which contain particles
+ *
+ * The list holds linear supercell indices (over all supercells including
+ * GUARD). Supercells of CORE are stored from the front, supercells of BORDER
+ * from the back of the list.
+ * The list is built while the gaps of CORE+BORDER are filled
+ * (see ParticlesBase::fillGaps()).
+ */
+struct ActiveSuperCellList
+{
+
+    HINLINE ActiveSuperCellList() : superCells(NULL), size(0), numCore(0), numBorder(0), isValid(false)
+    {
+    }
+
+    /* device pointer to the list */
+    uint32_t* superCells;
+    /* capacity of the list (number of supercells in CORE+BORDER) */
+    uint32_t size;
+    uint32_t numCore;
+    uint32_t numBorder;
+    /* false if particles were added to CORE+BORDER after the list was built */
+    bool isValid;
+};
+
+template<uint32_t areaType, class baseClass>
+class ActiveSuperCellMapping;
+
+/** mapping which launches one block per occupied supercell
+ *
+ * Kernels called with this mapping only see supercells of areaType which
+ * contain particles. If the list is not valid or areaType contains GUARD
+ * the mapping falls back to AreaMapping (one block per supercell of areaType).
+ * If no supercell is occupied there is nothing to launch (see isEmpty()).
+ * Kernels which need every cell (e.g. to write a field) must use AreaMapping.
+ *
+ * The blocks are spread over gridDim.x and gridDim.y. A grid with more than
+ * maxGridDimX blocks is split into launches with an exact number of blocks,
+ * call the kernel until next() returns false (like StrideMapping).
+ *
+ * @tparam areaType area to map to (CORE, BORDER or CORE + BORDER for the list)
+ */
+template<
+uint32_t areaType,
+template<unsigned, class> class baseClass,
+unsigned DIM,
+class SuperCellSize_
+>
+class ActiveSuperCellMapping<areaType, baseClass<DIM, SuperCellSize_> > : public baseClass<DIM, SuperCellSize_>
+{
+public:
+    typedef baseClass<DIM, SuperCellSize_> BaseClass;
+
+    enum
+    {
+        AreaType = areaType, Dim = BaseClass::Dim
+    };
+
+    typedef typename BaseClass::SuperCellSize SuperCellSize;
+
+    HINLINE ActiveSuperCellMapping(BaseClass base, const ActiveSuperCellList& activeSuperCells) :
+    BaseClass(base),
+    superCells(activeSuperCells.superCells),
+    listSize(activeSuperCells.size),
+    numFront((areaType & CORE) ? activeSuperCells.numCore : 0),
+    numBlocks(numFront + ((areaType & BORDER) ? activeSuperCells.numBorder : 0)),
+    blockOffset(0)
+    {
+        useList = activeSuperCells.isValid && (areaType & GUARD) == 0;
+    }
+
+    /** true if only occupied supercells are mapped */
+    HDINLINE bool isUsingList() const
+    {
+        return useList;
+    }
+
+    /** true if no supercell of areaType is occupied, the kernel must not be called */
+    HINLINE bool isEmpty() const
+    {
+        return useList && numBlocks == 0;
+    }
+
+    /**
+     * Generates cuda gridDim information for kernel call.
+     *
+     * @return dim3 with gridDim information
+     */
+    HINLINE DataSpace<DIM> getGridDim()
+    {
+        if (useList)
+        {
+            DataSpace<DIM> gridDim = DataSpace<DIM>::create(1);
+            const uint32_t remainingBlocks = numBlocks - blockOffset;
+            if (remainingBlocks < (uint32_t) maxGridDimX)
+            {
+                gridDim.x() = remainingBlocks;
+            }
+            else
+            {
+                gridDim.x() = maxGridDimX;
+                gridDim.y() = std::min(remainingBlocks / (uint32_t) maxGridDimX, (uint32_t) maxGridDimX);
+            }
+            return gridDim;
+        }
+        return this->reduce(AreaMappingMethods<areaType, DIM>::getGridDim(*this,
+                                                                           this->getGridSuperCells()));
+    }
+
+    /** select the blocks of the next launch
+     *
+     * @return false if all blocks are launched
+     */
+    HINLINE bool next()
+    {
+        if (!useList)
+            return false;
+        blockOffset += getGridDim().productOfComponents();
+        return blockOffset < numBlocks;
+    }
+
+    /**
+     * Returns index of current logical block, depending on current cuda block id.
+     *
+     * @param _blockIdx current cuda block id (blockIdx)
+     * @return current logical block index
+     */
+    DINLINE DataSpace<DIM> getSuperCellIndex(const DataSpace<DIM>& realSuperCellIdx)
+    {
+        if (useList)
+        {
+            const uint32_t blockId = blockOffset + realSuperCellIdx.y() * gridDim.x + realSuperCellIdx.x();
+            const uint32_t linearIdx = blockId < numFront ?
+                superCells[blockId] :
+                superCells[listSize - 1 - (blockId - numFront)];
+            return DataSpaceOperations<DIM>::map(this->getGridSuperCells(), linearIdx);
+        }
+        return AreaMappingMethods<areaType, DIM>::getBlockIndex(*this,
+                                                                this->getGridSuperCells(),
+                                                                extend(realSuperCellIdx));
+    }
+
+private:
+    /* largest gridDim.x and gridDim.y of sm_20 */
+    enum
+    {
+        maxGridDimX = 65535
+    };
+
+    PMACC_ALIGN(superCells, uint32_t*);
+    PMACC_ALIGN(listSize, uint32_t);
+    /* number of blocks mapped to the front (CORE part) of the list */
+    PMACC_ALIGN(numFront, uint32_t);
+    PMACC_ALIGN(numBlocks, uint32_t);
+    /* first block of the current launch */
+    PMACC_ALIGN(blockOffset, uint32_t);
+    PMACC_ALIGN(useList, bool);
+};
+
+} // namespace PMacc
@@ -56,8 +56,10 @@ namespace PMacc
              *
              * @param nodes number of GPU nodes in each dimension
              * @param periodic specifying whether the grid is periodic (1) or not (0) in each dimension
+             * @param nodeBlockPlacement place blocks of neighboring GPUs on the same node
              */
-            void init(DataSpace<DIM> nodes, DataSpace<DIM> periodic = DataSpace<DIM>())
+            void init(DataSpace<DIM> nodes, DataSpace<DIM> periodic = DataSpace<DIM>(),
+                      bool nodeBlockPlacement = false)
             {
                 static bool commIsInit = false;
                 if (!commIsInit)
@@ -90,7 +92,7 @@ namespace PMacc
                         periodicTmp[2] = periodic[2];
                     }
 
-                    comm.init(tmp, periodicTmp);
+                    comm.init(tmp, periodicTmp, nodeBlockPlacement);
                     commIsInit = true;
 
                     Environment<DIM>::get().EnvironmentController().setCommunicator(comm);
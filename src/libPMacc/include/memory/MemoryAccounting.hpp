@@ -0,0 +1,329 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of libPMacc.
+ *
+ * libPMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libPMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with libPMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <mpi.h>
+#include <map>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <string.h>
+
+#include "types.h"
+#include "communication/manager_common.h"
+
+namespace PMacc
+{
+
+/** bookkeeping of all host and device allocations of PMacc buffers
+ *
+ * Each allocation is tagged with the current owner (see MemoryOwner)
+ * and tracked by its pointer. For every owner the current usage and the
+ * peak usage (high-water mark) are kept separately for device and host
+ * memory. Mapped memory is host memory.
+ *
+ * Not thread safe, buffers must be created and freed by the main thread.
+ */
+class MemoryAccounting
+{
+public:
+
+    enum Location
+    {
+        DEVICE = 0, HOST = 1
+    };
+
+    static MemoryAccounting& getInstance()
+    {
+        static MemoryAccounting instance;
+        return instance;
+    }
+
+    /** record a new allocation of the current owner
+     *
+     * @param ptr pointer to the allocated memory, NULL is ignored
+     * @param location DEVICE or HOST
+     * @param bytes allocated bytes (including padding e.g. pitch)
+     */
+    void allocate(const void* ptr, Location location, size_t bytes)
+    {
+        if (ptr == NULL)
+            return;
+
+        Allocation allocation;
+        allocation.owner = getOwnerId(getOwner());
+        allocation.location = location;
+        allocation.bytes = bytes;
+        allocations[ptr] = allocation;
+
+        add(owners[allocation.owner], location, bytes);
+        add(total, location, bytes);
+    }
+
+    /** remove an allocation which was recorded with allocate() */
+    void release(const void* ptr)
+    {
+        AllocationMap::iterator it = allocations.find(ptr);
+        if (it == allocations.end())
+            return;
+
+        const Allocation& allocation = it->second;
+        owners[allocation.owner].current[allocation.location] -= allocation.bytes;
+        total.current[allocation.location] -= allocation.bytes;
+        allocations.erase(it);
+    }
+
+    /** name of the owner new allocations are tagged with */
+    std::string getOwner() const
+    {
+        return ownerStack.empty() ? std::string("untagged") : ownerStack.back();
+    }
+
+    /** current bytes of all owners on this rank */
+    size_t getCurrent(Location location) const
+    {
+        return total.current[location];
+    }
+
+    /** peak bytes of all owners on this rank */
+    size_t getPeak(Location location) const
+    {
+        return total.peak[location];
+    }
+
+    /** print a table with the usage of all owners
+     *
+     * Collective over all ranks of comm, the table is printed by rank 0.
+     * Current usage is shown as sum over all ranks and as maximum of
+     * one rank, the peak as maximum of one rank.
+     *
+     * @param comm communicator of all ranks which take part
+     * @param headline text in the first line of the table (e.g. "init")
+     */
+    void report(MPI_Comm comm, const std::string& headline)
+    {
+        /* serialize: name '\0' followed by current/peak of device and host */
+        std::vector<char> local;
+        for (size_t i = 0; i < ownerNames.size(); ++i)
+            serialize(local, ownerNames[i], owners[i]);
+        serialize(local, std::string("total"), total);
+
+        int rank;
+        int numRanks;
+        MPI_CHECK(MPI_Comm_rank(comm, &rank));
+        MPI_CHECK(MPI_Comm_size(comm, &numRanks));
+
+        int localSize = (int) local.size();
+        std::vector<int> sizes(numRanks, 0);
+        MPI_CHECK(MPI_Gather(&localSize, 1, MPI_INT, &(sizes[0]), 1, MPI_INT, 0, comm));
+
+        std::vector<int> displs(numRanks, 0);
+        int globalSize = 0;
+        for (int i = 0; i < numRanks; ++i)
+        {
+            displs[i] = globalSize;
+            globalSize += sizes[i];
+        }
+        std::vector<char> global(rank == 0 ? globalSize : 1);
+        MPI_CHECK(MPI_Gatherv(&(local[0]), localSize, MPI_CHAR,
+                              &(global[0]), &(sizes[0]), &(displs[0]), MPI_CHAR, 0, comm));
+
+        if (rank != 0)
+            return;
+
+        /* merge the owners of all ranks, keep the order of first appearance */
+        std::vector<std::string> names;
+        std::map<std::string, Summary> summaries;
+        size_t pos = 0;
+        while (pos < global.size())
+        {
+            const std::string name(&(global[pos]));
+            pos += name.size() + 1;
+            Usage usage;
+            memcpy(&usage, &(global[pos]), sizeof (Usage));
+            pos += sizeof (Usage);
+
+            if (summaries.find(name) == summaries.end())
+                names.push_back(name);
+            Summary& summary = summaries[name];
+            for (uint32_t l = 0; l < numLocations; ++l)
+            {
+                summary.sum[l] += usage.current[l];
+                summary.maxCurrent[l] = std::max(summary.maxCurrent[l], usage.current[l]);
+                summary.maxPeak[l] = std::max(summary.maxPeak[l], usage.peak[l]);
+            }
+        }
+
+        std::ostringstream out;
+        out << "memory usage [" << headline << "] of " << numRanks << " ranks in MiB" << std::endl;
+        out << std::setw(32) << std::left << "owner" << std::right <<
+            std::setw(12) << "dev sum" << std::setw(12) << "dev max" << std::setw(12) << "dev peak" <<
+            std::setw(12) << "host sum" << std::setw(12) << "host max" << std::setw(12) << "host peak" << std::endl;
+        for (size_t i = 0; i < names.size(); ++i)
+        {
+            const Summary& summary = summaries[names[i]];
+            out << std::setw(32) << std::left << names[i] << std::right << std::fixed << std::setprecision(1);
+            for (uint32_t l = 0; l < numLocations; ++l)
+            {
+                out << std::setw(12) << toMiB(summary.sum[l]) <<
+                    std::setw(12) << toMiB(summary.maxCurrent[l]) <<
+                    std::setw(12) << toMiB(summary.maxPeak[l]);
+            }
+            out << std::endl;
+        }
+        std::cout << out.str();
+        std::cout.flush();
+    }
+
+private:
+
+    friend class MemoryOwner;
+
+    static const uint32_t numLocations = 2;
+
+    struct Usage
+    {
+
+        Usage()
+        {
+            for (uint32_t l = 0; l < numLocations; ++l)
+            {
+                current[l] = 0;
+                peak[l] = 0;
+            }
+        }
+
+        uint64_t current[numLocations];
+        uint64_t peak[numLocations];
+    };
+
+    struct Summary
+    {
+
+        Summary()
+        {
+            for (uint32_t l = 0; l < numLocations; ++l)
+            {
+                sum[l] = 0;
+                maxCurrent[l] = 0;
+                maxPeak[l] = 0;
+            }
+        }
+
+        uint64_t sum[numLocations];
+        uint64_t maxCurrent[numLocations];
+        uint64_t maxPeak[numLocations];
+    };
+
+    struct Allocation
+    {
+        uint32_t owner;
+        Location location;
+        size_t bytes;
+    };
+
+    typedef std::map<const void*, Allocation> AllocationMap;
+
+    MemoryAccounting()
+    {
+    }
+
+    MemoryAccounting(const MemoryAccounting&);
+
+    MemoryAccounting& operator=(const MemoryAccounting&);
+
+    static void add(Usage& usage, Location location, size_t bytes)
+    {
+        usage.current[location] += bytes;
+        usage.peak[location] = std::max(usage.peak[location], usage.current[location]);
+    }
+
+    static double toMiB(uint64_t bytes)
+    {
+        return (double) bytes / 1024. / 1024.;
+    }
+
+    static void serialize(std::vector<char>& buffer, const std::string& name, const Usage& usage)
+    {
+        const size_t offset = buffer.size();
+        buffer.resize(offset + name.size() + 1 + sizeof (Usage));
+        memcpy(&(buffer[offset]), name.c_str(), name.size() + 1);
+        memcpy(&(buffer[offset + name.size() + 1]), &usage, sizeof (Usage));
+    }
+
+    uint32_t getOwnerId(const std::string& name)
+    {
+        std::map<std::string, uint32_t>::iterator it = ownerIds.find(name);
+        if (it != ownerIds.end())
+            return it->second;
+
+        const uint32_t id = ownerNames.size();
+        ownerIds[name] = id;
+        ownerNames.push_back(name);
+        owners.push_back(Usage());
+        return id;
+    }
+
+    AllocationMap allocations;
+    std::map<std::string, uint32_t> ownerIds;
+    std::vector<std::string> ownerNames;
+    std::vector<Usage> owners;
+    Usage total;
+    /* full names of the active MemoryOwner scopes */
+    std::vector<std::string> ownerStack;
+};
+
+/** tag all allocations within the lifetime of this object with an owner
+ *
+ * Scopes can be nested, the owner of an inner scope is prefixed with the
+ * owner of the outer scope (e.g. "FieldE/exchange").
+ */
+class MemoryOwner
+{
+public:
+
+    MemoryOwner(const std::string& name)
+    {
+        MemoryAccounting& accounting = MemoryAccounting::getInstance();
+        if (accounting.ownerStack.empty())
+            accounting.ownerStack.push_back(name);
+        else
+            accounting.ownerStack.push_back(accounting.ownerStack.back() + "/" + name);
+    }
+
+    ~MemoryOwner()
+    {
+        MemoryAccounting::getInstance().ownerStack.pop_back();
+    }
+
+private:
+
+    MemoryOwner(const MemoryOwner&);
+
+    MemoryOwner& operator=(const MemoryOwner&);
+};
+
+} //namespace PMacc
@@ -29,6 +29,7 @@
 #include "dimensions/DataSpace.hpp"
 #include "memory/buffers/DeviceBuffer.hpp"
 #include "memory/boxes/DataBox.hpp"
+#include "memory/MemoryAccounting.hpp"
 
 #include "eventSystem/tasks/Factory.hpp"
 
@@ -91,10 +92,12 @@ namespace PMacc
 
             if (sizeOnDevice)
             {
+                MemoryAccounting::getInstance().release(sizeOnDevicePtr);
                 CUDA_CHECK(cudaFree(sizeOnDevicePtr));
             }
             if (!useOtherMemory)
             {
+                MemoryAccounting::getInstance().release(data.ptr);
                 CUDA_CHECK(cudaFree(data.ptr));
 
             }
@@ -256,14 +259,19 @@ namespace PMacc
             if (DIM == DIM1)
             {
                 log<ggLog::MEMORY >("Create device 1D data: %1% MiB") % ( data.xsize  / 1024 / 1024 );
-                CUDA_CHECK(cudaMallocPitch(&data.ptr, &data.pitch, data.xsize , 1));
+                /* no cudaMallocPitch, the pitch is limited by cudaDevAttrMaxPitch (2 GiB)
+                 * which is smaller than large particle heaps */
+                CUDA_CHECK(cudaMalloc(&data.ptr, data.xsize));
+                data.pitch = data.xsize;
+                MemoryAccounting::getInstance().allocate(data.ptr, MemoryAccounting::DEVICE, data.pitch);
             }
             if (DIM == DIM2)
             {
                 data.ysize = this->data_space[1];
                 log<ggLog::MEMORY >("Create device 2D data: %1% MiB") % ( data.xsize * data.ysize / 1024 / 1024 );
                 CUDA_CHECK(cudaMallocPitch(&data.ptr, &data.pitch, data.xsize , data.ysize));
-
+                MemoryAccounting::getInstance().allocate(data.ptr, MemoryAccounting::DEVICE,
+                                                         data.pitch * data.ysize);
             }
             if (DIM == DIM3)
             {
@@ -274,6 +282,8 @@ namespace PMacc
 
                 log<ggLog::MEMORY >("Create device 3D data: %1% MiB") % ( this->data_space.productOfComponents() * sizeof (TYPE) / 1024 / 1024 );
                 CUDA_CHECK(cudaMalloc3D(&data, extent));
+                MemoryAccounting::getInstance().allocate(data.ptr, MemoryAccounting::DEVICE,
+                                                         data.pitch * extent.height * extent.depth);
             }
 
             reset(false);
@@ -291,6 +301,7 @@ namespace PMacc
 
             log<ggLog::MEMORY >("Create device fake data: %1% MiB") % ( this->data_space.productOfComponents() * sizeof (TYPE) / 1024 / 1024 );
             CUDA_CHECK(cudaMallocPitch(&data.ptr, &data.pitch, this->data_space.productOfComponents() * sizeof (TYPE), 1));
+            MemoryAccounting::getInstance().allocate(data.ptr, MemoryAccounting::DEVICE, data.pitch);
 
             //fake the pitch, thus we can use this 1D Buffer as 2D or 3D
             data.pitch = this->data_space[0] * sizeof (TYPE);
@@ -311,6 +322,7 @@ namespace PMacc
             if (sizeOnDevice)
             {
                 CUDA_CHECK(cudaMalloc(&sizeOnDevicePtr, sizeof (size_t)));
+                MemoryAccounting::getInstance().allocate(sizeOnDevicePtr, MemoryAccounting::DEVICE, sizeof (size_t));
             }
             setCurrentSize(Buffer<TYPE, DIM>::getDataSpace().productOfComponents());
         }
@@ -35,6 +35,7 @@
 
 #include "eventSystem/tasks/Factory.hpp"
 #include "eventSystem/tasks/TaskReceive.hpp"
+#include "communication/ExchangeAggregator.hpp"
 
 #include "memory/buffers/DeviceBufferIntern.hpp"
 #include "memory/buffers/HostBufferIntern.hpp"
@@ -84,6 +85,28 @@ namespace PMacc
             this->hostBuffer = new HostBufferIntern<TYPE, DIM > (tmp_size);
         }
 
+        /**
+         * exchange of an arbitrary region of source
+         *
+         * @param offset offset of the region in source
+         * @param size size of the region
+         */
+        ExchangeIntern(DeviceBufferIntern<TYPE, DIM>& source, DataSpace<DIM> offset, DataSpace<DIM> size,
+                       uint32_t exchange, uint32_t communicationTag, bool sizeOnDevice = false) :
+        Exchange<TYPE, DIM>(exchange, communicationTag), deviceDoubleBuffer(NULL)
+        {
+            /*This is only a pointer to other device data
+             */
+            this->deviceBuffer = new DeviceBufferIntern<TYPE, DIM > (source, size, offset, sizeOnDevice);
+            if (DIM > DIM1)
+            {
+                /*create double buffer on gpu for faster memory transfers*/
+                this->deviceDoubleBuffer = new DeviceBufferIntern<TYPE, DIM > (size, false, true);
+            }
+
+            this->hostBuffer = new HostBufferIntern<TYPE, DIM > (size);
+        }
+
         ExchangeIntern(DataSpace<DIM> exchangeDataSpace, uint32_t exchange,
                        uint32_t communicationTag, bool sizeOnDevice = false) :
         Exchange<TYPE, DIM>(exchange, communicationTag), deviceDoubleBuffer(NULL)
@@ -219,15 +242,22 @@ namespace PMacc
             return *deviceDoubleBuffer;
         }
 
-        EventTask startSend(EventTask &copyEvent)
+        /**
+         * @param copyEvent returns the event of the copy to the host
+         * @param slot slot of an aggregated message, invalid to send an own message
+         */
+        EventTask startSend(EventTask &copyEvent, const ExchangeSlot &slot = ExchangeSlot())
         {
             //assert(recvTask != NULL);
-            return Environment<>::get().Factory().createTaskSend(*this, copyEvent);
+            return Environment<>::get().Factory().createTaskSend(*this, copyEvent, slot);
         }
 
-        EventTask startReceive()
+        /**
+         * @param slot slot of an aggregated message, invalid to receive an own message
+         */
+        EventTask startReceive(const ExchangeSlot &slot = ExchangeSlot())
         {
-            return Environment<>::get().Factory().createTaskReceive(*this);
+            return Environment<>::get().Factory().createTaskReceive(*this, slot);
         }
 
     protected:
@@ -28,12 +28,15 @@
 
 #include "eventSystem/EventSystem.hpp"
 #include "dimensions/GridLayout.hpp"
+#include "mappings/simulation/Selection.hpp"
 #include "memory/dataTypes/Mask.hpp"
 
 #include "mappings/simulation/EnvironmentController.hpp"
 #include "memory/buffers/ExchangeIntern.hpp"
+#include "communication/ExchangeAggregator.hpp"
 #include "memory/buffers/HostBufferIntern.hpp"
 #include "memory/buffers/DeviceBufferIntern.hpp"
+#include "memory/MemoryAccounting.hpp"
 
 #include <sstream>
 #include <stdexcept>
@@ -218,6 +221,7 @@ public:
 
         lastUsedCommunicationTag = communicationTag;
 
+        MemoryOwner owner("exchange");
         receiveMask = receiveMask + receive;
         sendMask = this->receiveMask.getMirroredMask();
         Mask send = receive.getMirroredMask();
@@ -282,6 +286,7 @@ public:
         lastUsedCommunicationTag = communicationTag;
 
 
+        MemoryOwner owner("exchange");
         /*don't create buffer with 0 (zero) elements*/
         if (dataSpace.productOfComponents() != 0)
         {
@@ -322,6 +327,77 @@ public:
         }
     }
 
+    /**
+     * Add the face exchanges of a staged guard exchange.
+     *
+     * The guards are exchanged in DIM stages (x, y, z), each stage only with
+     * the two face neighbors of its dimension. The exchanges of a stage
+     * include the guards of all previous dimensions, so edges and corners
+     * are forwarded by the face neighbors: 2*DIM messages instead of up to
+     * 26, but DIM dependent stages per communication.
+     * Data is copied from the other BORDER to my GUARD. A GridBuffer with
+     * staged exchanges can not have other exchanges.
+     *
+     * @param originGuard guarding cells at the lower side of each dimension
+     * @param endGuard guarding cells at the upper side of each dimension
+     * @param communicationTag unique tag of this GridBuffer
+     * @param sizeOnDevice if true, internal buffers have their size information on the device, too
+     */
+    void addStagedExchange(const DataSpace<DIM> &originGuard, const DataSpace<DIM> &endGuard,
+                           uint32_t communicationTag, bool sizeOnDevice = false)
+    {
+        if (hasOneExchange)
+            throw std::runtime_error("staged exchanges can not be combined with other exchanges");
+
+        uint32_t positiveFace = 1;
+        for (uint32_t d = 0; d < DIM; ++d)
+        {
+            /* RIGHT, BOTTOM, BACK and LEFT, TOP, FRONT */
+            const uint32_t faces[2] = {positiveFace, 2 * positiveFace};
+            positiveFace *= 3;
+
+            for (uint32_t f = 0; f < 2; ++f)
+            {
+                const uint32_t recvex = faces[f];
+                const uint32_t ex = Mask::getMirroredExchangeType(recvex);
+                const uint32_t uniqCommunicationTag = (communicationTag << 5) | ex;
+                if (!privateGridBuffer::UniquTag::getInstance().isTagUniqu(uniqCommunicationTag))
+                {
+                    std::stringstream message;
+                    message << "unique exchange communication tag ("
+                        << uniqCommunicationTag << ") witch is created from communicationTag ("
+                        << communicationTag << ") allready used for other gridbuffer exchange";
+                    throw std::runtime_error(message.str());
+                }
+
+                DataSpace<DIM> offset;
+                DataSpace<DIM> size;
+                getStagedRegion(ex, BORDER, originGuard, endGuard, offset, size);
+                sendExchanges[ex] = new ExchangeIntern<BORDERTYPE, DIM > (*deviceBuffer, offset, size,
+                                                                          ex, uniqCommunicationTag, sizeOnDevice);
+
+                getStagedRegion(recvex, GUARD, originGuard, endGuard, offset, size);
+                receiveExchanges[recvex] = new ExchangeIntern<BORDERTYPE, DIM > (*deviceBuffer, offset, size,
+                                                                                 recvex, uniqCommunicationTag, sizeOnDevice);
+
+                maxExchange = std::max(maxExchange, std::max(ex, recvex) + 1u);
+                receiveMask = receiveMask + Mask(recvex);
+            }
+        }
+        sendMask = receiveMask.getMirroredMask();
+        hasOneExchange = true;
+        lastUsedCommunicationTag = communicationTag;
+        staged = true;
+    }
+
+    /**
+     * Returns whether the guards are exchanged in stages (\see addStagedExchange)
+     */
+    bool isStaged() const
+    {
+        return staged;
+    }
+
     /**
      * Returns whether this GridBuffer has an Exchange for sending in ex direction.
      *
@@ -438,30 +514,37 @@ public:
      */
     EventTask asyncCommunication(EventTask serialEvent)
     {
-        EventTask evR;
-        for (uint32_t i = 0; i < maxExchange; ++i)
-        {
-
-            evR += asyncReceive(serialEvent, i);
-
-            ExchangeType sendEx = Mask::getMirroredExchangeType(i);
-
-            EventTask copyEvent;
-            asyncSend(serialEvent, sendEx, copyEvent);
-            /* add only the copy event, because all work on gpu can run after data is copyed
-             */
-            evR += copyEvent;
+        return asyncCommunicationIntern(serialEvent, NULL);
+    }
 
-        }
-        return evR;
+    /**
+     * Starts sync data from own device buffer to neigbhor device buffer.
+     *
+     * Same as asyncCommunication(serialEvent), but all exchanges are added to
+     * phase and sent together with the exchanges of other buffers in the
+     * same phase (one message per neighbor).
+     * The data is sent after phase.close() was called.
+     * A staged GridBuffer (\see addStagedExchange) does not join the phase.
+     *
+     */
+    EventTask asyncCommunication(EventTask serialEvent, ExchangePhase &phase)
+    {
+        return asyncCommunicationIntern(serialEvent, &phase);
     }
 
-    EventTask asyncSend(EventTask serialEvent, uint32_t sendEx, EventTask &gpuFree)
+    /**
+     * @param phase if not NULL the exchange is sent as part of an aggregated message
+     */
+    EventTask asyncSend(EventTask serialEvent, uint32_t sendEx, EventTask &gpuFree,
+                        ExchangePhase *phase = NULL)
     {
         if (hasSendExchange(sendEx))
         {
             __startAtomicTransaction(serialEvent + sendEvents[sendEx]);
-            sendEvents[sendEx] = sendExchanges[sendEx]->startSend(gpuFree);
+            ExchangeSlot slot;
+            if (phase != NULL)
+                slot = phase->addSend(sendEx, sendExchanges[sendEx]->getCommunicationTag());
+            sendEvents[sendEx] = sendExchanges[sendEx]->startSend(gpuFree, slot);
             __endTransaction();
             /* add only the copy event, because all work on gpu can run after data is copyed
              */
@@ -470,12 +553,22 @@ public:
         return EventTask();
     }
 
-    EventTask asyncReceive(EventTask serialEvent, uint32_t recvEx)
+    /**
+     * @param phase if not NULL the exchange is received as part of an aggregated message
+     */
+    EventTask asyncReceive(EventTask serialEvent, uint32_t recvEx, ExchangePhase *phase = NULL)
     {
         if (hasReceiveExchange(recvEx))
         {
             __startAtomicTransaction(serialEvent + receiveEvents[recvEx]);
-            receiveEvents[recvEx] = receiveExchanges[recvEx]->startReceive();
+            ExchangeSlot slot;
+            if (phase != NULL)
+            {
+                HostBuffer<BORDERTYPE, DIM>& hostBuffer = receiveExchanges[recvEx]->getHostBuffer();
+                slot = phase->addReceive(recvEx, receiveExchanges[recvEx]->getCommunicationTag(),
+                                         hostBuffer.getDataSpace().productOfComponents() * sizeof (BORDERTYPE));
+            }
+            receiveEvents[recvEx] = receiveExchanges[recvEx]->startReceive(slot);
 
             __endTransaction();
             return receiveEvents[recvEx];
@@ -500,6 +593,38 @@ public:
         hostBuffer->copyFrom(*deviceBuffer);
     }
 
+    /**
+     * Asynchronously copies a region from internal device to internal host buffer.
+     *
+     * @param offset offset of the region (including guarding cells)
+     * @param size size of the region
+     */
+    void deviceToHost(const DataSpace<DIM>& offset, const DataSpace<DIM>& size)
+    {
+        hostBuffer->copyFrom(*deviceBuffer, offset, size);
+    }
+
+    /**
+     * Asynchronously copies a region from internal device to internal host buffer.
+     *
+     * @param region region including guarding cells, unused dimensions
+     *               are ignored (\see ISimulationData::synchronizeRegion)
+     */
+    void deviceToHost(const Selection<DIM3>& region)
+    {
+        DataSpace<DIM> offset;
+        DataSpace<DIM> size;
+        for (uint32_t d = 0; d < DIM; ++d)
+        {
+            offset[d] = region.offset[d];
+            size[d] = region.size[d];
+        }
+        log<ggLog::MEMORY > ("copy region to host: %1% of %2% byte") %
+            (size.productOfComponents() * sizeof (TYPE)) %
+            (gridLayout.getDataSpace().productOfComponents() * sizeof (TYPE));
+        deviceToHost(offset, size);
+    }
+
     /**
      * Returns the GridLayout describing this GridBuffer.
      *
@@ -514,8 +639,78 @@ private:
     
     friend Environment<DIM>;
 
+    EventTask asyncCommunicationIntern(EventTask serialEvent, ExchangePhase *phase)
+    {
+        if (staged)
+        {
+            /* later stages start when the guards of the previous stage
+             * are received, they can not be part of phase */
+            __startTransaction(serialEvent);
+            Environment<>::get().Factory().createTaskStagedCommunication(*this);
+            return __endTransaction();
+        }
+
+        EventTask evR;
+        for (uint32_t i = 0; i < maxExchange; ++i)
+        {
+
+            evR += asyncReceive(serialEvent, i, phase);
+
+            ExchangeType sendEx = Mask::getMirroredExchangeType(i);
+
+            EventTask copyEvent;
+            asyncSend(serialEvent, sendEx, copyEvent, phase);
+            /* add only the copy event, because all work on gpu can run after data is copyed
+             */
+            evR += copyEvent;
+
+        }
+        return evR;
+    }
+
+    /* offset and size of a face exchange of the staged schedule
+     *
+     * @param ex face exchange type
+     * @param area GUARD (receive) or BORDER (send)
+     */
+    void getStagedRegion(uint32_t ex, uint32_t area,
+                         const DataSpace<DIM> &originGuard, const DataSpace<DIM> &endGuard,
+                         DataSpace<DIM> &offset, DataSpace<DIM> &size) const
+    {
+        const DataSpace<DIM> guard = gridLayout.getGuard();
+        const DataSpace<DIM> coreBorder = gridLayout.getDataSpaceWithoutGuarding();
+        const DataSpace<DIM> direction = Mask::getRelativeDirections<DIM > (ex);
+
+        /* dimensions in front of the exchange dimension include their guards */
+        bool previousStage = true;
+        for (uint32_t d = 0; d < DIM; ++d)
+        {
+            if (direction[d] == 0)
+            {
+                offset[d] = previousStage ? guard[d] - originGuard[d] : guard[d];
+                size[d] = previousStage ? coreBorder[d] + originGuard[d] + endGuard[d] : coreBorder[d];
+                continue;
+            }
+            previousStage = false;
+
+            /* my lower guard is the upper border of the negative neighbor
+             * and has the size originGuard */
+            if (area == GUARD)
+            {
+                offset[d] = direction[d] < 0 ? guard[d] - originGuard[d] : guard[d] + coreBorder[d];
+                size[d] = direction[d] < 0 ? originGuard[d] : endGuard[d];
+            }
+            else
+            {
+                offset[d] = direction[d] < 0 ? guard[d] : guard[d] + coreBorder[d] - originGuard[d];
+                size[d] = direction[d] < 0 ? endGuard[d] : originGuard[d];
+            }
+        }
+    }
+
     void init(bool sizeOnDevice, bool buildDeviceBuffer = true, bool buildHostBuffer = true)
     {
+        staged = false;
         for (uint32_t i = 0; i < 27; ++i)
         {
             sendExchanges[i] = NULL;
@@ -554,6 +749,8 @@ protected:
     EventTask sendEvents[27];
 
     uint32_t maxExchange; //use max exchanges and run over the array is faster as use set from stl
+    /* exchanges are face exchanges of addStagedExchange */
+    bool staged;
 };
 
 }
@@ -53,6 +53,17 @@ namespace PMacc
          */
         virtual void copyFrom(DeviceBuffer<TYPE, DIM>& other) = 0;
 
+        /**
+         * Copies a region of the given DeviceBuffer to the same region of this HostBuffer.
+         *
+         * @param other DeviceBuffer to copy data from
+         * @param offset offset of the region
+         * @param size size of the region
+         */
+        virtual void copyFrom(DeviceBuffer<TYPE, DIM>& other,
+                              const DataSpace<DIM>& offset,
+                              const DataSpace<DIM>& size) = 0;
+
         /**
          * Returns the current size pointer.
          *
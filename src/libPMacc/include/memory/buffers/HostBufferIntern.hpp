@@ -30,6 +30,7 @@
 #include "eventSystem/EventSystem.hpp"
 
 #include "eventSystem/tasks/Factory.hpp"
+#include "memory/MemoryAccounting.hpp"
 
 namespace PMacc
 {
@@ -53,6 +54,8 @@ public:
     pointer(NULL),ownPointer(true)
     {
         CUDA_CHECK(cudaMallocHost(&pointer, dataSpace.productOfComponents() * sizeof (TYPE)));
+        MemoryAccounting::getInstance().allocate(pointer, MemoryAccounting::HOST,
+                                                 dataSpace.productOfComponents() * sizeof (TYPE));
         reset(false);
     }
 
@@ -73,6 +76,7 @@ public:
 
         if (pointer && ownPointer)
         {
+            MemoryAccounting::getInstance().release(pointer);
             CUDA_CHECK(cudaFreeHost(pointer));
         }
     }
@@ -98,6 +102,14 @@ public:
         Environment<>::get().Factory().createTaskCopyDeviceToHost(other, *this);
     }
 
+    void copyFrom(DeviceBuffer<TYPE, DIM>& other,
+                  const DataSpace<DIM>& offset,
+                  const DataSpace<DIM>& size)
+    {
+        assert(this->isMyDataSpaceGreaterThan(offset + size));
+        Environment<>::get().Factory().createTaskCopyDeviceToHost(other, *this, offset, size);
+    }
+
     void reset(bool preserveData = true)
     {
         __startOperation(ITask::TASK_HOST);
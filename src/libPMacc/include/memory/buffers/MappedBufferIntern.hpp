@@ -30,6 +30,7 @@
 #include "eventSystem/EventSystem.hpp"
 
 #include "eventSystem/tasks/Factory.hpp"
+#include "memory/MemoryAccounting.hpp"
 
 namespace PMacc
 {
@@ -51,6 +52,9 @@ public:
     pointer(NULL), ownPointer(true)
     {
         CUDA_CHECK(cudaMallocHost(&pointer, dataSpace.productOfComponents() * sizeof (TYPE), cudaHostAllocMapped));
+        /* mapped memory is host memory */
+        MemoryAccounting::getInstance().allocate(pointer, MemoryAccounting::HOST,
+                                                 dataSpace.productOfComponents() * sizeof (TYPE));
         reset(false);
     }
 
@@ -64,6 +68,7 @@ public:
 
         if (pointer && ownPointer)
         {
+            MemoryAccounting::getInstance().release(pointer);
             CUDA_CHECK(cudaFreeHost(pointer));
         }
     }
@@ -0,0 +1,204 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of libPMacc.
+ *
+ * libPMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libPMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with libPMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <mpi.h>
+#include <map>
+#include <vector>
+
+#include "types.h"
+#include "communication/manager_common.h"
+#include "mappings/simulation/GridController.hpp"
+#include "dimensions/DataSpace.hpp"
+#include "dimensions/DataSpaceOperations.hpp"
+#include "cuSTL/zone/SphericZone.hpp"
+
+namespace PMacc
+{
+namespace mpi
+{
+
+/** central cache of sub communicators
+ *
+ * Plugins and algorithms which work on a subset of ranks get their
+ * communicator from here instead of creating an own one.
+ * Communicators are created with MPI_Comm_split and shared by all users
+ * which ask for the same subset. The registry owns all communicators,
+ * users must never free them.
+ *
+ * All methods are collective over the ranks named in their description
+ * (a cache hit is decided on all ranks in the same way).
+ */
+class CommunicatorRegistry
+{
+public:
+
+    static CommunicatorRegistry& getInstance()
+    {
+        static CommunicatorRegistry instance;
+        return instance;
+    }
+
+    /** communicator of all ranks which set isActive
+     *
+     * collective over MPI_COMM_WORLD, ranks are ordered by their world rank
+     *
+     * @param isActive true if this rank is part of the communicator
+     * @return communicator, MPI_COMM_NULL if !isActive
+     */
+    MPI_Comm getParticipants(bool isActive)
+    {
+        const double start = MPI_Wtime();
+
+        int worldSize;
+        int worldRank;
+        MPI_CHECK(MPI_Comm_size(MPI_COMM_WORLD, &worldSize));
+        MPI_CHECK(MPI_Comm_rank(MPI_COMM_WORLD, &worldRank));
+
+        /* one bit per rank, the OR of all bits is the same key on all ranks */
+        std::vector<uint8_t> bits((worldSize + 7) / 8, 0);
+        std::vector<uint8_t> key(bits.size(), 0);
+        if (isActive)
+            bits[worldRank / 8] |= uint8_t(1u << (worldRank % 8));
+        MPI_CHECK(MPI_Allreduce(&(bits[0]), &(key[0]), (int) bits.size(),
+                                MPI_UNSIGNED_CHAR, MPI_BOR, MPI_COMM_WORLD));
+
+        MPI_Comm comm;
+        ParticipantsMap::iterator it = participants.find(key);
+        if (it != participants.end())
+        {
+            comm = it->second;
+            ++numCacheHits;
+        }
+        else
+        {
+            MPI_CHECK(MPI_Comm_split(MPI_COMM_WORLD, isActive ? 0 : MPI_UNDEFINED, worldRank, &comm));
+            participants[key] = comm;
+            ++numCreated;
+        }
+
+        setupTime += MPI_Wtime() - start;
+        return comm;
+    }
+
+    /** communicator of all ranks with a device grid position within zone
+     *
+     * Collective over all ranks of the device grid if the zone is
+     * requested the first time, a cached zone needs no communication.
+     * Ranks are ordered by their linear position in the device grid
+     * (x is the fastest index).
+     *
+     * @param zone zone in the device grid (e.g. a plane or a line)
+     * @return communicator, MPI_COMM_NULL if this rank is not in zone
+     */
+    template<int DIM>
+    MPI_Comm getZone(const zone::SphericZone<DIM>& zone)
+    {
+        std::vector<int> key;
+        key.push_back(DIM);
+        for (int d = 0; d < DIM; ++d)
+        {
+            key.push_back(zone.offset[d]);
+            key.push_back((int) zone.size[d]);
+        }
+
+        ZoneMap::iterator it = zones.find(key);
+        if (it != zones.end())
+        {
+            ++numCacheHits;
+            return it->second;
+        }
+
+        const double start = MPI_Wtime();
+
+        GridController<DIM>& gc = Environment<DIM>::get().GridController();
+        const DataSpace<DIM> gpuPos(gc.getPosition());
+        const DataSpace<DIM> gpuNodes(gc.getGpuNodes());
+
+        math::Int<DIM> pos;
+        for (int d = 0; d < DIM; ++d)
+            pos[d] = gpuPos[d];
+
+        MPI_Comm comm;
+        MPI_CHECK(MPI_Comm_split(gc.getCommunicator().getMPIComm(),
+                                 zone.within(pos) ? 0 : MPI_UNDEFINED,
+                                 DataSpaceOperations<DIM>::map(gpuNodes, gpuPos),
+                                 &comm));
+        zones[key] = comm;
+        ++numCreated;
+
+        setupTime += MPI_Wtime() - start;
+        return comm;
+    }
+
+    /** free all communicators
+     *
+     * must be called before MPI_Finalize
+     */
+    void finalize()
+    {
+        if (numCreated != 0)
+        {
+            log<ggLog::MPI > ("CommunicatorRegistry: %1% communicators created, %2% reused, setup time %3% s") %
+                numCreated % numCacheHits % setupTime;
+        }
+
+        for (ParticipantsMap::iterator it = participants.begin(); it != participants.end(); ++it)
+            if (it->second != MPI_COMM_NULL)
+                MPI_CHECK(MPI_Comm_free(&(it->second)));
+        participants.clear();
+
+        for (ZoneMap::iterator it = zones.begin(); it != zones.end(); ++it)
+            if (it->second != MPI_COMM_NULL)
+                MPI_CHECK(MPI_Comm_free(&(it->second)));
+        zones.clear();
+    }
+
+    /** accumulated time (seconds) spent in collectives of this registry */
+    double getSetupTime() const
+    {
+        return setupTime;
+    }
+
+private:
+
+    typedef std::map<std::vector<uint8_t>, MPI_Comm> ParticipantsMap;
+    typedef std::map<std::vector<int>, MPI_Comm> ZoneMap;
+
+    CommunicatorRegistry() : numCreated(0), numCacheHits(0), setupTime(0.0)
+    {
+    }
+
+    CommunicatorRegistry(const CommunicatorRegistry&);
+
+    CommunicatorRegistry& operator=(const CommunicatorRegistry&);
+
+    ParticipantsMap participants;
+    ZoneMap zones;
+    uint32_t numCreated;
+    uint32_t numCacheHits;
+    double setupTime;
+};
+
+} //namespace mpi
+} //namespace PMacc
@@ -30,6 +30,7 @@
 
 #include "mpi/GetMPI_StructAsArray.hpp"
 #include "mpi/GetMPI_Op.hpp"
+#include "mpi/CommunicatorRegistry.hpp"
 
 #include <cassert>
 #include "mpi/reduceMethods/AllReduce.hpp"
@@ -50,10 +51,7 @@ struct MPIReduce
 
     virtual ~MPIReduce()
     {
-        if (isMPICommInitialized)
-        {
-            MPI_CHECK(MPI_Comm_free(&comm));
-        }
+        /* the communicator is owned by the CommunicatorRegistry */
     }
 
     /*
@@ -79,49 +77,19 @@ struct MPIReduce
      */
     void participate(bool isActive)
     {
-        /*free old communicator of init is called again*/
-        if (isMPICommInitialized)
-        {
-            MPI_CHECK(MPI_Comm_free(&comm));
-            mpiRank = -1;
-            numRanks = 0;
-            isMPICommInitialized = false;
-        }
-
-        int countRanks;
-        MPI_CHECK(MPI_Comm_size(MPI_COMM_WORLD, &countRanks));
-        int reduceRank[countRanks];
-        int groupRanks[countRanks];
-        MPI_CHECK(MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank));
-
-        if (!isActive)
-            mpiRank = -1;
-
-        MPI_CHECK(MPI_Allgather(&mpiRank, 1, MPI_INT, reduceRank, 1, MPI_INT, MPI_COMM_WORLD));
-
-        for (int i = 0; i < countRanks; ++i)
-        {
-            if (reduceRank[i] != -1)
-            {
-                groupRanks[numRanks] = reduceRank[i];
-                numRanks++ ;
-            }
-        }
-
-        MPI_Group group = MPI_GROUP_NULL;
-        MPI_Group newgroup = MPI_GROUP_NULL;
-        MPI_CHECK(MPI_Comm_group(MPI_COMM_WORLD, &group));
-        MPI_CHECK(MPI_Group_incl(group, numRanks, groupRanks, &newgroup));
+        mpiRank = -1;
+        numRanks = 0;
+        isMPICommInitialized = false;
 
-        MPI_CHECK(MPI_Comm_create(MPI_COMM_WORLD, newgroup, &comm));
+        /* shared with all other reduces over the same ranks */
+        comm = CommunicatorRegistry::getInstance().getParticipants(isActive);
 
-        if (mpiRank != -1)
+        if (comm != MPI_COMM_NULL)
         {
             MPI_CHECK(MPI_Comm_rank(comm, &mpiRank));
+            MPI_CHECK(MPI_Comm_size(comm, &numRanks));
             isMPICommInitialized = true;
         }
-        MPI_CHECK(MPI_Group_free(&group));
-        MPI_CHECK(MPI_Group_free(&newgroup));
     }
 
     /* Reduce elements on cpu memory
@@ -0,0 +1,224 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of libPMacc.
+ *
+ * libPMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libPMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with libPMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <mpi.h>
+#include <vector>
+#include <string.h>
+
+#include "types.h"
+#include "communication/manager_common.h"
+#include "mpi/GetMPI_StructAsArray.hpp"
+#include "mpi/GetMPI_Op.hpp"
+#include "mpi/CommunicatorRegistry.hpp"
+
+namespace PMacc
+{
+namespace mpi
+{
+
+/** receiver of a result of the ReduceBatcher */
+class IReduceReceiver
+{
+public:
+
+    virtual ~IReduceReceiver()
+    {
+    }
+
+    /** called on the root rank if a batched reduce is finished
+     *
+     * @param currentStep step which was passed to ReduceBatcher::enqueue()
+     * @param tag tag which was passed to ReduceBatcher::enqueue()
+     * @param result reduced values, same type and count as the enqueued values
+     */
+    virtual void reduceFinished(uint32_t currentStep, uint32_t tag, const void* result) = 0;
+};
+
+/** combine small reductions of many plugins to few non-blocking collectives
+ *
+ * Plugins enqueue their local values during the plugin notification.
+ * flush() starts one MPI_Ireduce (root is rank 0 of MPI_COMM_WORLD)
+ * per MPI data type and operation, finish() waits for them and passes
+ * the results to the receivers. Between flush() and finish() the
+ * simulation continues.
+ *
+ * All ranks must enqueue the same reductions in the same order.
+ */
+class ReduceBatcher
+{
+public:
+
+    static ReduceBatcher& getInstance()
+    {
+        static ReduceBatcher instance;
+        return instance;
+    }
+
+    /** true if this rank gets the results (calls of reduceFinished) */
+    bool hasResult()
+    {
+        int rank;
+        MPI_CHECK(MPI_Comm_rank(getComm(), &rank));
+        return rank == 0;
+    }
+
+    /** add local values to the next batch
+     *
+     * @param func reduce functor, must specialize getMPI_Op
+     * @param src n local values, copied immediately
+     * @param n number of values
+     * @param currentStep step which is passed to the receiver
+     * @param receiver called with the reduced values on the root rank
+     * @param tag user defined id which is passed to the receiver
+     */
+    template<class Functor, typename Type>
+    void enqueue(Functor func, const Type* src, size_t n, uint32_t currentStep,
+                 IReduceReceiver* receiver, uint32_t tag = 0)
+    {
+        const MPI_StructAsArray type = getMPI_StructAsArray<Type > ();
+        Batch& batch = getBatch(type.dataType, getMPI_Op<Functor > ());
+
+        Entry entry;
+        entry.receiver = receiver;
+        entry.tag = tag;
+        entry.currentStep = currentStep;
+        entry.offset = batch.sendBuffer.size();
+        batch.entries.push_back(entry);
+
+        const size_t bytes = n * sizeof (Type);
+        batch.sendBuffer.resize(entry.offset + bytes);
+        memcpy(&(batch.sendBuffer[entry.offset]), src, bytes);
+        batch.count += n * type.sizeMultiplier;
+    }
+
+    /** start the collectives for all enqueued values
+     *
+     * a still running batch is finished first
+     */
+    void flush()
+    {
+        finish();
+        if (pending.empty())
+            return;
+
+        getComm();
+        requests.resize(pending.size());
+        for (size_t i = 0; i < pending.size(); ++i)
+        {
+            Batch& batch = pending[i];
+            batch.recvBuffer.resize(batch.sendBuffer.size());
+            MPI_CHECK(MPI_Ireduce(&(batch.sendBuffer[0]), &(batch.recvBuffer[0]),
+                                  batch.count, batch.dataType, batch.op, 0, comm,
+                                  &(requests[i])));
+        }
+        running.swap(pending);
+        pending.clear();
+    }
+
+    /** wait for the running collectives and deliver the results */
+    void finish()
+    {
+        if (running.empty())
+            return;
+
+        MPI_CHECK(MPI_Waitall((int) requests.size(), &(requests[0]), MPI_STATUSES_IGNORE));
+
+        if (hasResult())
+        {
+            for (size_t i = 0; i < running.size(); ++i)
+            {
+                Batch& batch = running[i];
+                for (size_t e = 0; e < batch.entries.size(); ++e)
+                {
+                    const Entry& entry = batch.entries[e];
+                    entry.receiver->reduceFinished(entry.currentStep, entry.tag,
+                                                   &(batch.recvBuffer[entry.offset]));
+                }
+            }
+        }
+        running.clear();
+        requests.clear();
+    }
+
+private:
+
+    struct Entry
+    {
+        IReduceReceiver* receiver;
+        uint32_t tag;
+        uint32_t currentStep;
+        size_t offset;
+    };
+
+    /** all values with the same data type and operation */
+    struct Batch
+    {
+        MPI_Datatype dataType;
+        MPI_Op op;
+        int count;
+        std::vector<char> sendBuffer;
+        std::vector<char> recvBuffer;
+        std::vector<Entry> entries;
+    };
+
+    ReduceBatcher() : comm(MPI_COMM_NULL)
+    {
+    }
+
+    ReduceBatcher(const ReduceBatcher&);
+
+    ReduceBatcher& operator=(const ReduceBatcher&);
+
+    /* collective over all ranks on first use */
+    MPI_Comm getComm()
+    {
+        if (comm == MPI_COMM_NULL)
+            comm = CommunicatorRegistry::getInstance().getParticipants(true);
+        return comm;
+    }
+
+    /* batches are kept in order of their first use,
+     * which is the same on all ranks */
+    Batch& getBatch(MPI_Datatype dataType, MPI_Op op)
+    {
+        for (size_t i = 0; i < pending.size(); ++i)
+            if (pending[i].dataType == dataType && pending[i].op == op)
+                return pending[i];
+
+        Batch batch;
+        batch.dataType = dataType;
+        batch.op = op;
+        batch.count = 0;
+        pending.push_back(batch);
+        return pending.back();
+    }
+
+    MPI_Comm comm;
+    std::vector<Batch> pending;
+    std::vector<Batch> running;
+    std::vector<MPI_Request> requests;
+};
+
+} //namespace mpi
+} //namespace PMacc
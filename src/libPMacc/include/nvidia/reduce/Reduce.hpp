@@ -28,6 +28,7 @@
 
 #include "nvidia/functors/Assign.hpp"
 #include "traits/GetValueType.hpp"
+#include "memory/MemoryAccounting.hpp"
 #include <boost/type_traits.hpp>
 
 namespace PMacc
@@ -107,7 +108,7 @@ namespace PMacc
                 HINLINE Reduce(const uint32_t byte, const uint32_t sharedMemByte = 4 * 1024) :
                 byte(byte), sharedMemByte(sharedMemByte), reduceBuffer(NULL)
                 {
-
+                    MemoryOwner owner("reduce");
                     reduceBuffer = new GridBuffer<char, DIM1 > (DataSpace<DIM1 > (byte));
                 }
 
@@ -34,6 +34,10 @@ namespace rng
 {
 
 /* create a random number generator on gpu
+ *
+ * The generator is usable on the host if RNGMethod and Distribution
+ * support host code (e.g. methods::Philox).
+ *
  * \tparam RngMethod method to generate random number
  * \tparam Distribution functor for distribution
  */
@@ -46,7 +50,8 @@ public:
      * \param rngMethod instance of generator
      * \param distribution instance of distribution functor
      */
-    DINLINE RNG(const RNGMethod& rng_method, const Distribution& rng_operation) :
+    PMACC_NO_NVCC_HDWARNING
+    HDINLINE RNG(const RNGMethod& rng_method, const Distribution& rng_operation) :
     RNGMethod(rng_method), op(rng_operation)
     {
     }
@@ -54,7 +59,8 @@ public:
     /* default method to generate a random number
      * @return random number
      */
-    DINLINE typename Distribution::Type operator()()
+    PMACC_NO_NVCC_HDWARNING
+    HDINLINE typename Distribution::Type operator()()
     {
         return this->op(this->getStatePtr());
     }
@@ -71,8 +77,9 @@ private:
  * \param distribution instance of distribution functor
  * \return class which can used to generate random numbers
  */
+PMACC_NO_NVCC_HDWARNING
 template<class RngMethod, class Distribution>
-DINLINE typename PMacc::nvidia::rng::RNG<RngMethod, Distribution> create(const RngMethod & rngMethod,
+HDINLINE typename PMacc::nvidia::rng::RNG<RngMethod, Distribution> create(const RngMethod & rngMethod,
                                                                                      const Distribution & distribution)
 {
     return PMacc::nvidia::rng::RNG<RngMethod, Distribution > (rngMethod, distribution);
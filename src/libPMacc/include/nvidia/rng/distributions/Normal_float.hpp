@@ -26,6 +26,7 @@
 
 #include <curand_kernel.h>
 #include "types.h"
+#include "nvidia/rng/methods/Philox.hpp"
 
 namespace PMacc
 {
@@ -43,7 +44,7 @@ namespace PMacc
                 public:
                     typedef float Type;
 
-                    DINLINE Normal_float()
+                    HDINLINE Normal_float()
                     {
                     }
 
@@ -53,6 +54,31 @@ namespace PMacc
                         return curand_normal(state);
                     }
 
+                    /* counter based generator, usable on host and device
+                     *
+                     * Box-Muller transformation, the second value is cached
+                     * in the state and returned by the next call.
+                     */
+                    HDINLINE Type operator()(methods::PhiloxState* state) const
+                    {
+                        if (state->hasSpareNormal)
+                        {
+                            state->hasSpareNormal = false;
+                            return state->spareNormal;
+                        }
+                        /* (0.f, 1.0f] to avoid log(0) */
+                        const Type u1 = static_cast<Type>((state->next() >> 8) + 1u) * (Type(1.0) / Type(16777216.0));
+                        /* [0.f, 1.0f) */
+                        const Type u2 = static_cast<Type>(state->next() >> 8) * (Type(1.0) / Type(16777216.0));
+
+                        const Type r = sqrtf(Type(-2.0) * logf(u1));
+                        const Type phi = Type(2.0 * 3.14159265358979323846) * u2;
+
+                        state->spareNormal = r * sinf(phi);
+                        state->hasSpareNormal = true;
+                        return r * cosf(phi);
+                    }
+
                 };
             }
         }
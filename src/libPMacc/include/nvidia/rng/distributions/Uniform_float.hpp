@@ -26,6 +26,7 @@
 
 #include <curand_kernel.h>
 #include "types.h"
+#include "nvidia/rng/methods/Philox.hpp"
 
 namespace PMacc
 {
@@ -43,7 +44,7 @@ namespace PMacc
                 public:
                     typedef float Type;
 
-                    DINLINE Uniform_float()
+                    HDINLINE Uniform_float()
                     {
                     }
 
@@ -65,6 +66,13 @@ namespace PMacc
                         return r;
                     }
 
+                    /* counter based generator, usable on host and device */
+                    HDINLINE Type operator()(methods::PhiloxState* state) const
+                    {
+                        /* use the upper 24 bit (float mantissa): [0.f, 1.0f) */
+                        return static_cast<Type>(state->next() >> 8) * (Type(1.0) / Type(16777216.0));
+                    }
+
                 };
             }
         }
@@ -25,6 +25,7 @@
 
 #include <curand_kernel.h>
 #include "types.h"
+#include "nvidia/rng/methods/Philox.hpp"
 
 namespace PMacc
 {
@@ -43,7 +44,7 @@ namespace PMacc
                 public:
                     typedef int32_t Type;
 
-                    DINLINE Uniform_int()
+                    HDINLINE Uniform_int32()
                     {
                     }
 
@@ -53,6 +54,12 @@ namespace PMacc
                         /*curand create a random 32Bit int value*/
                         return curand(state);
                     }
+
+                    /* counter based generator, usable on host and device */
+                    HDINLINE Type operator()(methods::PhiloxState* state) const
+                    {
+                        return static_cast<Type>(state->next());
+                    }
                 };
             }
         }
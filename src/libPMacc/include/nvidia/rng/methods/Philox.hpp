@@ -0,0 +1,173 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of libPMacc.
+ *
+ * libPMacc is free software: you can redistribute it and/or modify
+ * it under the terms of of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libPMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with libPMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "types.h"
+
+namespace PMacc
+{
+namespace nvidia
+{
+namespace rng
+{
+namespace methods
+{
+
+/** state of the counter based Philox4x32-10 generator
+ *
+ * The state is only a 128bit counter and a 64bit key, the random numbers
+ * are a pure function of (key, counter). Therefore creating a state is
+ * for free and the produced stream is identical on host and device.
+ *
+ * Counter layout: [0] running index, [1] high bits of the running index,
+ *                 [2] subsequence (e.g. cell or particle index),
+ *                 [3] offset (e.g. time step)
+ */
+struct PhiloxState
+{
+    uint32_t counter[4];
+    uint32_t key[2];
+    /* last generated block of four random numbers */
+    uint32_t result[4];
+    /* number of already consumed values in result */
+    uint32_t used;
+    /* second value of the last Box-Muller transformation */
+    float spareNormal;
+    bool hasSpareNormal;
+
+    /** get next 32bit random number */
+    HDINLINE uint32_t next()
+    {
+        if (used == 4u)
+        {
+            generate();
+            used = 0u;
+        }
+        return result[used++];
+    }
+
+private:
+
+    static const uint32_t mulA = 0xD2511F53u;
+    static const uint32_t mulB = 0xCD9E8D57u;
+    static const uint32_t weylA = 0x9E3779B9u;
+    static const uint32_t weylB = 0xBB67AE85u;
+
+    HDINLINE static uint32_t mulHiLo(uint32_t a, uint32_t b, uint32_t& lo)
+    {
+        lo = a * b;
+#ifdef __CUDA_ARCH__
+        return __umulhi(a, b);
+#else
+        return static_cast<uint32_t> ((static_cast<uint64_t> (a) * b) >> 32);
+#endif
+    }
+
+    /* calculate one block of 4 random numbers and increment the counter */
+    HDINLINE void generate()
+    {
+        uint32_t c0 = counter[0];
+        uint32_t c1 = counter[1];
+        uint32_t c2 = counter[2];
+        uint32_t c3 = counter[3];
+        uint32_t k0 = key[0];
+        uint32_t k1 = key[1];
+
+        for (int round = 0; round < 10; ++round)
+        {
+            uint32_t lo0;
+            uint32_t lo1;
+            const uint32_t hi0 = mulHiLo(mulA, c0, lo0);
+            const uint32_t hi1 = mulHiLo(mulB, c2, lo1);
+
+            c0 = hi1 ^ c1 ^ k0;
+            c1 = lo1;
+            c2 = hi0 ^ c3 ^ k1;
+            c3 = lo0;
+
+            k0 += weylA;
+            k1 += weylB;
+        }
+
+        result[0] = c0;
+        result[1] = c1;
+        result[2] = c2;
+        result[3] = c3;
+
+        /* only the running index is incremented, subsequence and offset
+         * are never touched to keep the streams disjoint */
+        if (++counter[0] == 0u)
+            ++counter[1];
+    }
+};
+
+/** counter based random number generator (Philox4x32-10)
+ *
+ * Drop-in replacement for methods::Xor without the expensive initialisation
+ * of a XORWOW state (skip ahead to the subsequence).
+ * The generated stream only depends on the constructor arguments,
+ * therefore it is reproducible across restarts and between host and device.
+ */
+class Philox
+{
+public:
+    typedef PhiloxState StateType;
+    typedef StateType* StatePtr;
+
+    /**
+     * \param seed seed of the stream (e.g. from mpi::SeedPerRank)
+     * \param subsequence unique id of the stream (e.g. cell or particle index)
+     * \param offset second unique id (e.g. time step)
+     */
+    HDINLINE Philox(uint32_t seed = 0, uint32_t subsequence = 0, uint32_t offset = 0)
+    {
+        state.counter[0] = 0u;
+        state.counter[1] = 0u;
+        state.counter[2] = subsequence;
+        state.counter[3] = offset;
+        state.key[0] = seed;
+        state.key[1] = 0u;
+        state.used = 4u;
+        state.spareNormal = 0.0f;
+        state.hasSpareNormal = false;
+    }
+protected:
+
+    HDINLINE StateType* getStatePtr()
+    {
+        return &state;
+    }
+
+    HDINLINE StateType& getState()
+    {
+        return state;
+    }
+
+private:
+    PMACC_ALIGN(state, StateType);
+};
+}
+}
+}
+}
@@ -24,6 +24,7 @@
 
 #include "types.h"
 #include "identifier/value_identifier.hpp"
+#include "identifier/alias.hpp"
 #include "particles/frame_types.hpp"
 
 namespace PMacc
@@ -46,4 +47,11 @@ value_identifier(lcellId_t,localCellIdx,0);
  */
 value_identifier(uint8_t,multiMask,0);
 
+/** flag to select the format of particles in exchange frames
+ *
+ * e.g. exchangeFormat<particles::exchange::Compact<> >
+ * @see particles/exchange/ExchangeFormat.hpp
+ */
+alias(exchangeFormat);
+
 } //namespace PMacc
@@ -30,6 +30,8 @@
 #include "particles/memory/buffers/ParticlesBuffer.hpp"
 
 #include "mappings/kernel/StrideMapping.hpp"
+#include "mappings/kernel/ActiveSuperCellMapping.hpp"
+#include "memory/buffers/GridBuffer.hpp"
 #include "traits/NumberOfExchanges.hpp"
 
 
@@ -67,33 +69,89 @@ protected:
 
     BufferType *particlesBuffer;
 
-    ParticlesBase(MappingDesc description) : SimulationFieldHelper<MappingDesc>(description), particlesBuffer(NULL)
+    ParticlesBase(MappingDesc description) : SimulationFieldHelper<MappingDesc>(description), particlesBuffer(NULL),
+    activeSuperCellsValid(false)
     {
+        const DataSpace<Dim> coreBorderSuperCells(description.getGridSuperCells() -
+                                                  2 * description.getGuardingSuperCells());
+        activeSuperCells = new GridBuffer<uint32_t, DIM1 > (
+            DataSpace<DIM1 > (coreBorderSuperCells.productOfComponents()));
+        /* [0] occupied supercells in CORE, [1] in BORDER */
+        activeSuperCellCounters = new GridBuffer<uint32_t, DIM1 > (DataSpace<DIM1 > (2));
+    }
+
+    virtual ~ParticlesBase()
+    {
+        __delete(activeSuperCells);
+        __delete(activeSuperCellCounters);
+    }
+
+    /* true if the gaps of AREA are filled for all supercells of CORE and BORDER,
+     * in this case the list of occupied supercells is rebuilt */
+    template<uint32_t AREA>
+    bool isRebuildingActiveSuperCells() const
+    {
+        return (AREA & CORE) && (AREA & BORDER);
+    }
+
+    /* start a new list of occupied supercells */
+    void resetActiveSuperCells()
+    {
+        activeSuperCellCounters->getDeviceBuffer().setValue(0);
+        activeSuperCellsValid = true;
+    }
+
+    /* copy the counters of the new list to the host
+     *
+     * The copy is queued directly behind the kernel which built the list,
+     * getActiveSuperCells() only waits for this copy and not for all work
+     * queued later.
+     */
+    void copyActiveSuperCellCounters()
+    {
+        activeSuperCellCounters->deviceToHost();
+        activeCountersEvent = __getTransactionEvent();
     }
 
     /* Shift all particle in a AREA
      * @tparam AREA area whish is used (CORE,BORDER,GUARD or a combination)
+     * @param onlyToGuard shift only particles which leave to the GUARD,
+     *                    all other particles must be shifted by a later call
+     *                    with onlyToGuard=false
      */
     template<uint32_t AREA>
-    void shiftParticles()
+    void shiftParticles(bool onlyToGuard = false)
     {
         StrideMapping<AREA, DIM3, MappingDesc> mapper(this->cellDescription);
         ParticlesBoxType pBox = particlesBuffer->getDeviceParticleBox();
 
         __startTransaction(__getTransactionEvent());
+        const bool buildList = !onlyToGuard && isRebuildingActiveSuperCells<AREA>();
+        if (buildList)
+            resetActiveSuperCells();
+        uint32_t* counters = buildList ?
+            activeSuperCellCounters->getDeviceBuffer().getBasePointer() : NULL;
         do
         {
             __cudaKernel(kernelShiftParticles)
                 (mapper.getGridDim(), TileSize)
-                (pBox, mapper);
-            __cudaKernel(kernelFillGaps)
-                (mapper.getGridDim(), TileSize)
-                (pBox, mapper);
-            __cudaKernel(kernelFillGapsLastFrame)
-                (mapper.getGridDim(), TileSize)
-                (pBox, mapper);
+                (pBox, mapper, onlyToGuard);
+            /* gaps can only be filled if no particle is marked for a shift */
+            if (!onlyToGuard)
+            {
+                __cudaKernel(kernelFillGaps)
+                    (mapper.getGridDim(), TileSize)
+                    (pBox, mapper);
+                __cudaKernel(kernelFillGapsLastFrame)
+                    (mapper.getGridDim(), TileSize)
+                    (pBox, mapper,
+                     activeSuperCells->getDeviceBuffer().getBasePointer(), counters,
+                     activeSuperCells->getGridLayout().getDataSpace().productOfComponents());
+            }
         }
         while (mapper.next());
+        if (buildList)
+            copyActiveSuperCellCounters();
 
         __setTransactionEvent(__endTransaction());
 
@@ -111,11 +169,29 @@ protected:
             (mapper.getGridDim(), TileSize)
             (particlesBuffer->getDeviceParticleBox(), mapper);
 
+        const bool buildList = isRebuildingActiveSuperCells<AREA>();
+        if (buildList)
+            resetActiveSuperCells();
         __cudaKernel(kernelFillGapsLastFrame)
             (mapper.getGridDim(), TileSize)
-            (particlesBuffer->getDeviceParticleBox(), mapper);
+            (particlesBuffer->getDeviceParticleBox(), mapper,
+             activeSuperCells->getDeviceBuffer().getBasePointer(),
+             buildList ? activeSuperCellCounters->getDeviceBuffer().getBasePointer() : NULL,
+             activeSuperCells->getGridLayout().getDataSpace().productOfComponents());
+        if (buildList)
+            copyActiveSuperCellCounters();
     }
 
+private:
+
+    /* linear indices of the occupied supercells of CORE and BORDER */
+    GridBuffer<uint32_t, DIM1> *activeSuperCells;
+    GridBuffer<uint32_t, DIM1> *activeSuperCellCounters;
+    /* false if particles were added to CORE or BORDER after the last rebuild */
+    bool activeSuperCellsValid;
+    /* copy of activeSuperCellCounters to the host */
+    EventTask activeCountersEvent;
+
 
 public:
 
@@ -133,6 +209,40 @@ public:
         this->fillGaps < BORDER > ();
     }
 
+    /* Get the list of supercells of CORE and BORDER which contain particles.
+     *
+     * The list is rebuilt each time the gaps of CORE and BORDER are filled.
+     * The host waits until the counters of the last rebuild are copied,
+     * work which was queued after the rebuild keeps running on the device.
+     * Use the result with ActiveSuperCellMapping.
+     */
+    ActiveSuperCellList getActiveSuperCells()
+    {
+        ActiveSuperCellList list;
+        list.isValid = activeSuperCellsValid;
+        if (!activeSuperCellsValid)
+            return list;
+
+        activeCountersEvent.waitForFinished();
+        /* atomic transaction: reading the host buffer must not wait for the whole queue */
+        __startAtomicTransaction(__getTransactionEvent());
+        list.superCells = activeSuperCells->getDeviceBuffer().getBasePointer();
+        list.size = activeSuperCells->getGridLayout().getDataSpace().productOfComponents();
+        list.numCore = activeSuperCellCounters->getHostBuffer().getDataBox()[0];
+        list.numBorder = activeSuperCellCounters->getHostBuffer().getDataBox()[1];
+        __endTransaction();
+        return list;
+    }
+
+    /* Mark the list of occupied supercells as outdated,
+     * must be called if particles are added to CORE or BORDER
+     * without filling the gaps of CORE and BORDER afterwards.
+     */
+    void invalidateActiveSuperCells()
+    {
+        activeSuperCellsValid = false;
+    }
+
     /* Delete all particles in GUARD for one direction.
      */
     void deleteGuardParticles(uint32_t exchangeType);
@@ -167,8 +277,12 @@ public:
     /* Communicate particles to neighbor devices.
      * This method include bashing and insert of particles full
      * asynchron.
+     *
+     * @param fillBorderGaps fill the gaps in BORDER after all particles are inserted,
+     *                       must be false if particles in BORDER are still marked
+     *                       for a shift (see shiftParticles())
      */
-    EventTask asyncCommunication(EventTask event);
+    EventTask asyncCommunication(EventTask event, bool fillBorderGaps = true);
 };
 
 } //namespace PMacc
@@ -83,11 +83,14 @@ namespace PMacc
     }
 
     template<typename T_ParticleDescription, class MappingDesc>
-    EventTask ParticlesBase<T_ParticleDescription, MappingDesc>::asyncCommunication(EventTask event)
+    EventTask ParticlesBase<T_ParticleDescription, MappingDesc>::asyncCommunication(EventTask event, bool fillBorderGaps)
     {
+        /* received particles are inserted into BORDER */
+        invalidateActiveSuperCells();
+
         EventTask ret;
         __startTransaction(event);
-        Environment<>::get().ParticleFactory().createTaskParticlesReceive(*this);
+        Environment<>::get().ParticleFactory().createTaskParticlesReceive(*this, fillBorderGaps);
         ret = __endTransaction();
 
         __startTransaction(event);
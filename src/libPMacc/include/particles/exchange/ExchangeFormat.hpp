@@ -0,0 +1,273 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of libPMacc.
+ *
+ * libPMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libPMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with libPMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+#include "static_assert.hpp"
+#include "particles/Identifier.hpp"
+#include "traits/HasFlag.hpp"
+#include "traits/GetFlagType.hpp"
+#include "traits/GetNComponents.hpp"
+#include "math/Vector.hpp"
+
+#include <boost/mpl/vector.hpp>
+#include <boost/mpl/find_if.hpp>
+#include <boost/mpl/end.hpp>
+#include <boost/mpl/deref.hpp>
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/identity.hpp>
+#include <boost/mpl/copy_if.hpp>
+#include <boost/mpl/transform.hpp>
+#include <boost/mpl/back_inserter.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+namespace PMacc
+{
+namespace particles
+{
+namespace exchange
+{
+
+/** encoder which sends an attribute unchanged
+ *
+ * An encoder describes how one attribute is stored in an exchange frame:
+ *  - ::Identifier value_identifier of the attribute
+ *  - ::WireType type in the exchange frame
+ *  - ::isSent false if the attribute is not part of the exchange frame
+ *  - encode<T_Key>(dest, src) writes attribute T_Key of particle src to
+ *    the exchange particle dest
+ *  - decode<T_Key>(dest, src) writes attribute T_Key of the exchange
+ *    particle src to particle dest
+ *
+ * @tparam T_Identifier value_identifier or alias of the attribute
+ */
+template<typename T_Identifier>
+struct FullValue
+{
+    typedef T_Identifier Identifier;
+    typedef typename T_Identifier::type WireType;
+    static const bool isSent = true;
+
+    template<typename T_Key, typename T_Dest, typename T_Src>
+    static HDINLINE void encode(T_Dest& dest, const T_Src& src)
+    {
+        dest[T_Key()] = src[T_Key()];
+    }
+
+    template<typename T_Key, typename T_Dest, typename T_Src>
+    static HDINLINE void decode(T_Dest& dest, const T_Src& src)
+    {
+        dest[T_Key()] = src[T_Key()];
+    }
+};
+
+/** encoder which sends the components of an attribute as normalized fixed point
+ *
+ * The components must be in [0,1) (e.g. an in-cell position). A component
+ * is stored as integer with 2^(8*sizeof(T_StorageType)) steps and decoded
+ * to the center of its step, the maximal error is half a step.
+ *
+ * @tparam T_Identifier value_identifier or alias of the attribute
+ * @tparam T_StorageType unsigned integral type with less than 32 bit
+ */
+template<typename T_Identifier, typename T_StorageType = uint16_t>
+struct NormalizedFixedPoint
+{
+    typedef T_Identifier Identifier;
+    typedef typename T_Identifier::type ValueType;
+    typedef typename ValueType::type ComponentType;
+
+    enum
+    {
+        numComponents = traits::GetNComponents<ValueType>::value
+    };
+
+    typedef T_StorageType StorageType;
+    typedef PMacc::math::Vector<StorageType, numComponents> WireType;
+    static const bool isSent = true;
+
+    PMACC_CASSERT_MSG(storage_type_must_have_less_than_32_bit, sizeof (StorageType) < sizeof (uint32_t));
+
+    template<typename T_Key, typename T_Dest, typename T_Src>
+    static HDINLINE void encode(T_Dest& dest, const T_Src& src)
+    {
+        const ComponentType steps = ComponentType(1u << (8 * sizeof (StorageType)));
+        const ValueType value = src[T_Key()];
+        WireType& wire = dest[T_Key()];
+        for (uint32_t d = 0; d < numComponents; ++d)
+        {
+            const ComponentType scaled = value[d] * steps;
+            /* clamp values which are rounded to 1.0 */
+            wire[d] = scaled < steps ? StorageType(scaled) : StorageType(~StorageType(0));
+        }
+    }
+
+    template<typename T_Key, typename T_Dest, typename T_Src>
+    static HDINLINE void decode(T_Dest& dest, const T_Src& src)
+    {
+        const ComponentType stepSize = ComponentType(1.0) / ComponentType(1u << (8 * sizeof (StorageType)));
+        const WireType wire = src[T_Key()];
+        ValueType& value = dest[T_Key()];
+        for (uint32_t d = 0; d < numComponents; ++d)
+            value[d] = (ComponentType(wire[d]) + ComponentType(0.5)) * stepSize;
+    }
+};
+
+/** encoder for an attribute which is equal for all particles
+ *
+ * The attribute is not sent, the receiver sets the value of T_Value.
+ *
+ * @tparam T_Identifier value_identifier of the attribute
+ * @tparam T_Value class with `static HDINLINE T_Identifier::type get()`
+ */
+template<typename T_Identifier, typename T_Value>
+struct Constant
+{
+    typedef T_Identifier Identifier;
+    typedef typename T_Identifier::type WireType;
+    static const bool isSent = false;
+
+    template<typename T_Key, typename T_Dest, typename T_Src>
+    static HDINLINE void encode(T_Dest&, const T_Src&)
+    {
+    }
+
+    template<typename T_Key, typename T_Dest, typename T_Src>
+    static HDINLINE void decode(T_Dest& dest, const T_Src&)
+    {
+        dest[T_Key()] = T_Value::get();
+    }
+};
+
+/** format which sends all attributes unchanged
+ *
+ * A format defines
+ *  - ::ConstantAttributes sequence of attributes which are not sent
+ *  - ::packed true if the attributes of an exchange frame are not padded
+ *  - ::apply<T_Key>::type encoder of attribute T_Key (@see FullValue)
+ *
+ * This is the format of species without an exchangeFormat flag.
+ */
+struct FullPrecision
+{
+    typedef bmpl::vector0<> ConstantAttributes;
+    static const bool packed = false;
+
+    template<typename T_Key>
+    struct apply
+    {
+        typedef FullValue<T_Key> type;
+    };
+};
+
+namespace detail
+{
+
+template<typename T_Encoder>
+struct GetIdentifier
+{
+    /* ThisType of an alias (e.g. position<position_pic>) is the value_identifier */
+    typedef typename T_Encoder::Identifier::ThisType type;
+};
+
+template<typename T_Encoder>
+struct GetConstantIdentifier
+{
+    typedef typename T_Encoder::Identifier type;
+};
+
+template<typename T_Encoder>
+struct IsConstant
+{
+    typedef bmpl::bool_<!T_Encoder::isSent> type;
+};
+
+template<typename T_Type>
+struct GetThisType
+{
+    typedef typename T_Type::ThisType type;
+};
+
+} //namespace detail
+
+/** format with packed exchange frames and user defined encoders
+ *
+ * Attributes without an encoder are sent unchanged. Packed frames drop the
+ * padding of every attribute to a power of two (e.g. a float3 needs 12
+ * instead of 16 byte).
+ *
+ * @tparam T_Encoders sequence of encoders (@see NormalizedFixedPoint, Constant)
+ */
+template<typename T_Encoders = bmpl::vector0<> >
+struct Compact
+{
+    typedef T_Encoders Encoders;
+
+    typedef typename bmpl::transform<
+        typename bmpl::copy_if<
+            Encoders,
+            detail::IsConstant<bmpl::_1>,
+            bmpl::back_inserter<bmpl::vector0<> >
+        >::type,
+        detail::GetConstantIdentifier<bmpl::_1>
+    >::type ConstantAttributes;
+
+    static const bool packed = true;
+
+    template<typename T_Key>
+    struct apply
+    {
+        typedef typename bmpl::find_if<
+            Encoders,
+            boost::is_same<detail::GetIdentifier<bmpl::_1>, typename T_Key::ThisType>
+        >::type Iter;
+
+        typedef typename bmpl::eval_if<
+            boost::is_same<Iter, typename bmpl::end<Encoders>::type>,
+            bmpl::identity<FullValue<T_Key> >,
+            bmpl::deref<Iter>
+        >::type type;
+    };
+};
+
+/** get the exchange format of a frame
+ *
+ * @tparam T_FrameType frame with the flag exchangeFormat<> or without
+ * @treturn ::type format of the exchangeFormat flag, FullPrecision if the flag is not set
+ */
+template<typename T_FrameType>
+struct GetExchangeFormat
+{
+    typedef typename traits::HasFlag<T_FrameType, exchangeFormat<> >::type HasFormat;
+
+    typedef typename bmpl::eval_if<
+        HasFormat,
+        detail::GetThisType<typename traits::GetFlagType<T_FrameType, exchangeFormat<> >::type>,
+        bmpl::identity<FullPrecision>
+    >::type type;
+};
+
+} //namespace exchange
+} //namespace particles
+} //namespace PMacc
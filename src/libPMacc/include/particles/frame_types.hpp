@@ -26,8 +26,10 @@
 
 #include "types.h"
 
-//define which index means that the index is invalid
-#define INV_IDX 0xFFFFFFFF
+/* use 64 bit frame indices (default 32 bit), see vint_t */
+#ifndef PMACC_FRAME_INDEX_64
+#define PMACC_FRAME_INDEX_64 0
+#endif
 
 //define which index means that a local cell index is invalid
 #define INV_LOC_IDX 0xFFFF
@@ -38,10 +40,15 @@ namespace PMacc
 
 
     /**
-     * Is used for indirect pointer layer.
-     * This type is limited by atomicSub on device (in CUDA 3.2 we can use 32 Bit int only).
+     * Is used for indirect pointer layer (index of a frame in the frame heap).
+     * 32 bit by default, 64 bit if PMACC_FRAME_INDEX_64 is set to 1.
+     * Atomic operations on this type must use the wrappers in basicOperations.hpp.
      */
-    typedef  unsigned  int vint_t;
+#if (PMACC_FRAME_INDEX_64 == 1)
+    typedef uint64_cu vint_t;
+#else
+    typedef uint32_t vint_t;
+#endif
 
 
 
@@ -56,6 +63,9 @@ namespace PMacc
     enum FrameType { CORE_FRAME = 0u, BORDER_FRAME =1u , BIG_FRAME=2u};
 }
 
+//define which index means that the index is invalid (all bits set)
+#define INV_IDX (~(PMacc::vint_t) 0)
+
 
 #endif	/* FRAME_TYPES_HPP */
 
@@ -74,6 +74,29 @@ public:
         return virtualMemory.pop();
     }
 
+    /**
+     * Reserves count consecutive indices from virtual memory.
+     *
+     * @param count number of indices to reserve
+     * @return handle of the first reserved index, use with getReserved()
+     */
+    HDINLINE TYPE popIdxN(TYPE count)
+    {
+        return virtualMemory.popN(count);
+    }
+
+    /**
+     * Returns the VALUE of a reserved index.
+     *
+     * @param first handle returned by popIdxN()
+     * @param offset index within the reserved range
+     * @return reference to VALUE
+     */
+    HDINLINE VALUE &getReserved(TYPE first, TYPE offset)
+    {
+        return (*this)[virtualMemory.getPopped(first, offset)];
+    }
+
     /**
      * Computes the index of the VALUE at address old and pushes it to virtual memory.
      *
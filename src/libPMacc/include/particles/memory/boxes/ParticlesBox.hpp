@@ -67,6 +67,31 @@ public:
         return data.pop();
     }
 
+    /**
+     * Reserves a range of empty frames from the data heap.
+     *
+     * The frames are not linked to any supercell.
+     *
+     * @param count number of frames
+     * @return handle of the first frame, use with getReservedFrame()
+     */
+    HDINLINE vint_t reserveFrames(vint_t count)
+    {
+        return data.popIdxN(count);
+    }
+
+    /**
+     * Returns a frame of a range reserved with reserveFrames().
+     *
+     * @param first handle returned by reserveFrames()
+     * @param offset index of the frame within the reserved range
+     * @return an empty frame
+     */
+    HDINLINE FRAME &getReservedFrame(vint_t first, vint_t offset)
+    {
+        return data.getReserved(first, offset);
+    }
+
     /**
      * Removes frame from heap data heap.
      *
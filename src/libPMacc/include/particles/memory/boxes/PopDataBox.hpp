@@ -27,10 +27,13 @@
 #include <cuda.h>
 
 #include "particles/memory/boxes/TileDataBox.hpp"
+#include "basicOperations.hpp"
 
 #include "memory/boxes/DataBox.hpp"
 #include "memory/boxes/PitchedBox.hpp"
 
+#include <boost/type_traits/make_signed.hpp>
+
 namespace PMacc
 {
 
@@ -63,18 +66,20 @@ public:
     /**
      * Removes count elements from the stack in an atomic operation.
      *
-     * \todo This method unse int32_t and limits the element count to INT_MAX
+     * The size is interpreted signed, an underflow of a former call is
+     * seen as negative size.
      *
      * @param count number of elements to pop from stack
      * @return a TileDataBox of type VALUE with count elements
      */
     HDINLINE TileDataBox<VALUE> popN(TYPE count)
     {
+        typedef typename boost::make_signed<TYPE>::type SignedType;
 #if !defined(__CUDA_ARCH__) // Host code path
-        int32_t old_addr = (*currentSize);
+        SignedType old_addr = (SignedType) (*currentSize);
         (*currentSize) -= count;
 #else
-        int32_t old_addr = (int32_t) atomicSub((int32_t*) currentSize, (int32_t) count);
+        SignedType old_addr = (SignedType) atomicSubWrapper(currentSize, count);
 #endif
 
         if (old_addr <= 0)
@@ -83,7 +88,7 @@ public:
             return TileDataBox<VALUE > (this->fixedPointer, DataSpace<DIM1 > (0), 0);
         }
 
-        if (old_addr < (int32_t) count)
+        if (old_addr < (SignedType) count)
         {
             *currentSize = 0;
             return TileDataBox<VALUE > (this->fixedPointer, DataSpace<DIM1 > (0), old_addr);
@@ -104,7 +109,7 @@ public:
 #if !defined(__CUDA_ARCH__) // Host code path
         TYPE old_addr = --(*currentSize);
 #else
-        TYPE old_addr = atomicSub(currentSize, 1) - 1;
+        TYPE old_addr = atomicSubWrapper(currentSize, (TYPE) 1) - 1;
 #endif
         return (*this)[old_addr];
     }
@@ -26,6 +26,7 @@
 #include <cuda.h>
 
 #include "particles/memory/boxes/TileDataBox.hpp"
+#include "basicOperations.hpp"
 
 #include "memory/boxes/DataBox.hpp"
 #include "memory/boxes/PitchedBox.hpp"
@@ -79,7 +80,7 @@ public:
         const TYPE old_idx = (indexBox[PUSH]);
         old_idx >= size - 1 ? (indexBox[PUSH]) = 0 : (indexBox[PUSH]) = old_idx + 1;
 #else
-        const TYPE old_idx = atomicInc(&(indexBox[PUSH]), size - 1);
+        const TYPE old_idx = atomicIncWrapper(&(indexBox[PUSH]), size - 1);
 #endif
         (*this)[old_idx] = val;
     }
@@ -101,7 +102,7 @@ public:
         old_idx >= size - 1 ? (indexBox[POP]) = 0 : (indexBox[POP]) = old_idx + 1;
 
 #else
-        const TYPE old_idx = atomicInc(&(indexBox[POP]), size - 1);
+        const TYPE old_idx = atomicIncWrapper(&(indexBox[POP]), size - 1);
 #endif
 #if (__CUDA_ARCH__>=200)
         /*old_idx == F*/
@@ -126,9 +127,44 @@ public:
         return (*this)[old_idx];
     }
 
-    /*HDINLINE TileDataBox<VALUE> pushN(TYPE count);
+    /**
+     * Removes count elements from the front of the buffer in one atomic operation.
+     *
+     * The removed elements are consecutive in the ring and can be accessed
+     * with getPopped().
+     *
+     * @param count number of elements to remove
+     * @return ring position of the first removed element
+     */
+    HDINLINE TYPE popN(TYPE count)
+    {
+#if !defined(__CUDA_ARCH__) // Host code path
+        const TYPE old_idx = (indexBox[POP]);
+        (indexBox[POP]) = (old_idx + count) % size;
+#else
+        TYPE old_idx = indexBox[POP];
+        TYPE assumed;
+        do
+        {
+            assumed = old_idx;
+            old_idx = atomicCAS(&(indexBox[POP]), assumed, (assumed + count) % size);
+        }
+        while (assumed != old_idx);
+#endif
+        return old_idx;
+    }
 
-    HDINLINE  TileDataBox<VALUE> popN(TYPE count);*/
+    /**
+     * Returns an element which was removed with popN().
+     *
+     * @param first ring position returned by popN()
+     * @param offset index of the element within the removed range
+     * @return the element of type VALUE
+     */
+    HDINLINE VALUE &getPopped(TYPE first, TYPE offset)
+    {
+        return (*this)[(first + offset) % size];
+    }
 
 protected:
     PMACC_ALIGN(indexBox, IndexBoxType);
@@ -128,6 +128,14 @@ public:
         ringBuffer->clear();
     }
 
+    /**
+     * Returns the number of unused elements (synchronous).
+     */
+    size_t getNumFreeElements()
+    {
+        return ringBuffer->getNumElements();
+    }
+
     /**
      * Initializes the internal RingBuffer.
      */
@@ -50,6 +50,11 @@
 #include <boost/mpl/vector.hpp>
 #include <boost/mpl/pair.hpp>
 #include "particles/ParticleDescription.hpp"
+#include "particles/exchange/ExchangeFormat.hpp"
+#include "compileTime/conversion/RemoveFromSeq.hpp"
+#include <boost/mpl/if.hpp>
+#include <algorithm>
+#include <climits>
 
 
 namespace PMacc
@@ -82,6 +87,21 @@ public:
         };
     };
 
+    /** create static array with one element of the wire type of an exchange format
+     */
+    template<typename T_ExchangeFormat>
+    struct OperatorCreatePairExchangeArray
+    {
+        template<typename X>
+        struct apply
+        {
+            typedef
+            bmpl::pair<X,
+            StaticArray< typename T_ExchangeFormat::template apply<X>::type::WireType, bmpl::integral_c<uint32_t,1u> >
+            > type;
+        };
+    };
+
     typedef ExchangeMemoryIndex<vint_t, DIM - 1 > PopPushType;
 
     typedef SuperCellSize_ SuperCellSize;
@@ -93,12 +113,6 @@ public:
     multiMask
     >::type full_particleList;
 
-    typedef
-    typename MakeSeq<
-    typename T_ParticleDescription::ValueTypeSeq,
-    localCellIdx
-    >::type border_particleList;
-
     typedef
     typename ReplaceValueTypeSeq<T_ParticleDescription, full_particleList>::type
     ParticleDescriptionDefault;
@@ -106,11 +120,32 @@ public:
     typedef Frame<
     OperatorCreatePairStaticArray<PMacc::math::CT::volume<SuperCellSize>::type::value >, ParticleDescriptionDefault> ParticleType;
 
+    /* format of particles in exchange frames, selected with the flag exchangeFormat<> */
+    typedef typename particles::exchange::GetExchangeFormat<ParticleType>::type ExchangeFormat;
+
+    typedef
+    typename MakeSeq<
+    typename T_ParticleDescription::ValueTypeSeq,
+    localCellIdx
+    >::type fullPrecisionBorder_particleList;
+
+    /* attributes which are equal for all particles are not sent */
+    typedef
+    typename RemoveFromSeq<
+    fullPrecisionBorder_particleList,
+    typename ExchangeFormat::ConstantAttributes
+    >::type border_particleList;
+
     typedef
     typename ReplaceValueTypeSeq<T_ParticleDescription, border_particleList>::type
     ParticleDescriptionBorder;
 
-    typedef Frame<OperatorCreatePairStaticArray<1u >, ParticleDescriptionBorder> ParticleTypeBorder;
+    typedef
+    typename bmpl::if_c<
+    ExchangeFormat::packed,
+    Frame<OperatorCreatePairExchangeArray<ExchangeFormat>, ParticleDescriptionBorder, pmath::NativeData>,
+    Frame<OperatorCreatePairExchangeArray<ExchangeFormat>, ParticleDescriptionBorder>
+    >::type ParticleTypeBorder;
 
 
 private:
@@ -123,6 +158,10 @@ private:
         SizeOfOneFrame = HeapBuffer<vint_t, ParticleType, ParticleTypeBorder >::SizeOfOneFrame + 2 * sizeof (vint_t)
     };
 
+    /* exchange frame without exchange format, only used to report the saved bytes */
+    typedef Frame<OperatorCreatePairStaticArray<1u >,
+    typename ReplaceValueTypeSeq<T_ParticleDescription, fullPrecisionBorder_particleList>::type> FullPrecisionBorder;
+
 public:
 
     /**
@@ -149,19 +188,22 @@ public:
     void createParticleBuffer(size_t gpuMemory)
     {
 
-        numFrames = gpuMemory / SizeOfOneFrame;
+        /* frame indices must be smaller than INV_IDX and the frame
+         * count must fit into a DataSpace component */
+        const size_t maxFrames = std::min((size_t) (INV_IDX - 1), (size_t) INT_MAX);
+        numFrames = std::min(gpuMemory / SizeOfOneFrame, maxFrames);
 
         frames = new HeapBuffer<vint_t, ParticleType, ParticleTypeBorder > (DataSpace<DIM1 > (numFrames));
 
         nextFrames = new GridBuffer<vint_t, DIM1 > (DataSpace<DIM1 > (numFrames));
         prevFrames = new GridBuffer<vint_t, DIM1 > (DataSpace<DIM1 > (numFrames));
 
-        /** \fixme use own log level, like log<ggLog::MEMORY >
-         */
-        std::cout << "mem for particles=" << gpuMemory / 1024 / 1024 << " MiB = " <<
-            numFrames << " Frames = " <<
-            numFrames * superCellSize.productOfComponents() <<
-            " Particles" << std::endl;
+        log<ggLog::MEMORY > ("mem for particles=%1% MiB = %2% Frames = %3% Particles") %
+            (gpuMemory / 1024 / 1024) % numFrames %
+            (numFrames * superCellSize.productOfComponents());
+
+        log<ggLog::COMMUNICATION > ("particle exchange: %1% byte per particle (%2% byte with full precision)") %
+            sizeof (ParticleTypeBorder) % sizeof (FullPrecisionBorder);
 
         reset();
     }
@@ -292,9 +334,12 @@ public:
      */
     EventTask asyncCommunication(EventTask serialEvent)
     {
-
-        return framesExchanges->asyncCommunication(serialEvent) +
-            exchangeMemoryIndexer->asyncCommunication(serialEvent);
+        /* frames and their indexer are sent with one message per neighbor */
+        ExchangePhase phase;
+        EventTask returnEvent = framesExchanges->asyncCommunication(serialEvent, phase) +
+            exchangeMemoryIndexer->asyncCommunication(serialEvent, phase);
+        phase.close();
+        return returnEvent;
     }
 
     EventTask asyncSendParticles(EventTask serialEvent, uint32_t ex, EventTask &gpuFree)
@@ -302,17 +347,22 @@ public:
         /*store every gpu free event seperat to avoid raceconditions*/
         EventTask framesExchangesGPUEvent;
         EventTask exchangeMemoryIndexerGPUEvent;
-        EventTask returnEvent = framesExchanges->asyncSend(serialEvent, ex, framesExchangesGPUEvent) +
-            exchangeMemoryIndexer->asyncSend(serialEvent, ex, exchangeMemoryIndexerGPUEvent);
+        /* frames and their indexer are sent with one message */
+        ExchangePhase phase;
+        EventTask returnEvent = framesExchanges->asyncSend(serialEvent, ex, framesExchangesGPUEvent, &phase) +
+            exchangeMemoryIndexer->asyncSend(serialEvent, ex, exchangeMemoryIndexerGPUEvent, &phase);
+        phase.close();
         gpuFree = framesExchangesGPUEvent + exchangeMemoryIndexerGPUEvent;
         return returnEvent;
     }
 
     EventTask asyncReceiveParticles(EventTask serialEvent, uint32_t ex)
     {
-
-        return framesExchanges->asyncReceive(serialEvent, ex) +
-            exchangeMemoryIndexer->asyncReceive(serialEvent, ex);
+        ExchangePhase phase;
+        EventTask returnEvent = framesExchanges->asyncReceive(serialEvent, ex, &phase) +
+            exchangeMemoryIndexer->asyncReceive(serialEvent, ex, &phase);
+        phase.close();
+        return returnEvent;
     }
 
     /**
@@ -410,6 +460,16 @@ public:
         return numFrames;
     }
 
+    /**
+     * Returns number of frames which are not used by any supercell (synchronous).
+     *
+     * @return number of free frames
+     */
+    size_t getFreeFrameCount()
+    {
+        return frames->getNumFreeElements();
+    }
+
 private:
     GridBuffer<PopPushType, DIM1> *exchangeMemoryIndexer;
 
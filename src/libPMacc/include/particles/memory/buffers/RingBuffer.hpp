@@ -178,6 +178,24 @@ public:
     {
         return ringData->getHostBuffer().getDataSpace().productOfComponents();
     }
+
+    /**
+     * Returns the number of elements which can be removed (synchronous).
+     *
+     * Copies the indices from device to host and waits for the copy.
+     *
+     * @return number of elements in the buffer
+     */
+    size_t getNumElements()
+    {
+        ringDataSizes->deviceToHost();
+        DataBox<PitchedBox<TYPE, DIM1> > indexBox = ringDataSizes->getHostBuffer().getDataBox();
+        const size_t size = getSize();
+        /* equal indices mean that all elements are in the ring
+         * (removing all elements is reported as overflow by pop()) */
+        const size_t removed = ((size_t) indexBox[POP] + size - (size_t) indexBox[PUSH]) % size;
+        return size - removed;
+    }
 private:
     GridBuffer<VALUE, DIM1> *ringData;
     GridBuffer<TYPE, DIM1> *ringDataSizes;
@@ -65,12 +65,15 @@ namespace pmacc = PMacc;
  *                       (e.g. calculate mass, gamma, ...)
  * @tparam T_Flags sequence with identifiers to add flags on a frame
  *                 (e.g. useSolverXY, calcRadiation, ...)
+ * @tparam T_PODType storage of one attribute, pmath::AlignedData pads every
+ *                   attribute to a power of two, pmath::NativeData packs the attributes
  */
 template<typename T_CreatePairOperator,
-typename T_ParticleDescription >
+typename T_ParticleDescription,
+template<typename> class T_PODType = pmath::AlignedData >
 struct Frame :
 public InheritLinearly<typename T_ParticleDescription::MethodsList>,
-    protected pmath::MapTuple<typename SeqToMap<typename T_ParticleDescription::ValueTypeSeq, T_CreatePairOperator>::type, pmath::AlignedData>
+    protected pmath::MapTuple<typename SeqToMap<typename T_ParticleDescription::ValueTypeSeq, T_CreatePairOperator>::type, T_PODType>
 {
     typedef T_ParticleDescription ParticleDescription;
     typedef typename ParticleDescription::Name Name;
@@ -78,9 +81,9 @@ public InheritLinearly<typename T_ParticleDescription::MethodsList>,
     typedef typename ParticleDescription::ValueTypeSeq ValueTypeSeq;
     typedef typename ParticleDescription::MethodsList MethodsList;
     typedef typename ParticleDescription::FlagsList FlagList;
-    typedef Frame<T_CreatePairOperator, ParticleDescription> ThisType;
+    typedef Frame<T_CreatePairOperator, ParticleDescription, T_PODType> ThisType;
     /* definition of the MapTupel where we inherit from*/
-    typedef pmath::MapTuple<typename SeqToMap<ValueTypeSeq, T_CreatePairOperator>::type, pmath::AlignedData> BaseType;
+    typedef pmath::MapTuple<typename SeqToMap<ValueTypeSeq, T_CreatePairOperator>::type, T_PODType> BaseType;
 
     /* type of a single particle*/
     typedef pmacc::Particle<ThisType> ParticleType;
@@ -156,15 +159,16 @@ namespace traits
 
 template<typename T_IdentifierName,
 typename T_CreatePairOperator,
-typename T_ParticleDescription
+typename T_ParticleDescription,
+template<typename> class T_PODType
 >
 struct HasIdentifier<
-PMacc::Frame<T_CreatePairOperator, T_ParticleDescription>,
+PMacc::Frame<T_CreatePairOperator, T_ParticleDescription, T_PODType>,
 T_IdentifierName
 >
 {
 private:
-    typedef PMacc::Frame<T_CreatePairOperator, T_ParticleDescription> FrameType;
+    typedef PMacc::Frame<T_CreatePairOperator, T_ParticleDescription, T_PODType> FrameType;
 public:
     typedef typename FrameType::ValueTypeSeq ValueTypeSeq;
     /* if T_IdentifierName is void_ than we have no T_IdentifierName in our Sequence.
@@ -177,13 +181,14 @@ public:
 
 template<typename T_IdentifierName,
 typename T_CreatePairOperator,
-typename T_ParticleDescription
+typename T_ParticleDescription,
+template<typename> class T_PODType
 >
 struct HasFlag<
-PMacc::Frame<T_CreatePairOperator, T_ParticleDescription>,T_IdentifierName>
+PMacc::Frame<T_CreatePairOperator, T_ParticleDescription, T_PODType>,T_IdentifierName>
 {
 private:
-    typedef PMacc::Frame<T_CreatePairOperator,T_ParticleDescription> FrameType;
+    typedef PMacc::Frame<T_CreatePairOperator, T_ParticleDescription, T_PODType> FrameType;
     typedef typename GetFlagType<FrameType,T_IdentifierName>::type SolvedAliasName;
     typedef typename FrameType::FlagList FlagList;
 public:
@@ -193,13 +198,14 @@ public:
 
 template<typename T_IdentifierName,
 typename T_CreatePairOperator,
-typename T_ParticleDescription
+typename T_ParticleDescription,
+template<typename> class T_PODType
 >
 struct GetFlagType<
-PMacc::Frame<T_CreatePairOperator, T_ParticleDescription>,T_IdentifierName>
+PMacc::Frame<T_CreatePairOperator, T_ParticleDescription, T_PODType>,T_IdentifierName>
 {
 private:
-    typedef PMacc::Frame<T_CreatePairOperator, T_ParticleDescription> FrameType;
+    typedef PMacc::Frame<T_CreatePairOperator, T_ParticleDescription, T_PODType> FrameType;
     typedef typename FrameType::FlagList FlagList;
 public:
 
@@ -107,6 +107,7 @@ struct CountParticles
     template<uint32_t AREA, class PBuffer, class Filter, class CellDesc>
     static uint64_cu countOnDevice(PBuffer& buffer, CellDesc cellDescription, Filter filter)
     {
+        MemoryOwner owner("CountParticles");
         GridBuffer<uint64_cu, DIM1> counter(DataSpace<DIM1>(1));
 
         dim3 block(CellDesc::SuperCellSize::toRT().toDim3());
@@ -0,0 +1,101 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of libPMacc.
+ *
+ * libPMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libPMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with libPMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+#include "algorithms/ForEach.hpp"
+#include "RefWrapper.hpp"
+
+namespace PMacc
+{
+namespace particles
+{
+namespace operations
+{
+
+namespace detail
+{
+
+/** encode one attribute with the encoder of the exchange format */
+template<typename T_Key, typename T_ExchangeFormat>
+struct EncodeIdentifier
+{
+    typedef typename T_ExchangeFormat::template apply<T_Key>::type Encoder;
+
+    template<typename T_Dest, typename T_Src>
+    HDINLINE void operator()(T_Dest& dest, const T_Src& src)
+    {
+        Encoder::template encode<T_Key>(dest, src);
+    }
+};
+
+/** decode one attribute with the encoder of the exchange format */
+template<typename T_Key, typename T_ExchangeFormat>
+struct DecodeIdentifier
+{
+    typedef typename T_ExchangeFormat::template apply<T_Key>::type Encoder;
+
+    template<typename T_Dest, typename T_Src>
+    HDINLINE void operator()(T_Dest& dest, const T_Src& src)
+    {
+        Encoder::template decode<T_Key>(dest, src);
+    }
+};
+
+} //namespace detail
+
+/** write a particle to an exchange frame
+ *
+ * @tparam T_ExchangeFormat format of the exchange frame
+ *         (@see particles/exchange/ExchangeFormat.hpp)
+ * @param dest particle of the exchange frame, all attributes are written
+ * @param src particle with at least all attributes of dest
+ */
+template<typename T_ExchangeFormat, typename T_Dest, typename T_Src>
+HDINLINE void encodeExchange(T_Dest& dest, const T_Src& src)
+{
+    algorithms::forEach::ForEach<typename T_Dest::ValueTypeSeq,
+        detail::EncodeIdentifier<bmpl::_1, T_ExchangeFormat> > encode;
+    encode(forward(dest), src);
+}
+
+/** read a particle from an exchange frame
+ *
+ * Attributes which are not sent (ConstantAttributes of the format) are set
+ * by their encoder.
+ *
+ * @tparam T_ExchangeFormat format of the exchange frame
+ * @param dest particle, all attributes are written
+ * @param src particle of the exchange frame
+ */
+template<typename T_ExchangeFormat, typename T_Dest, typename T_Src>
+HDINLINE void decodeExchange(T_Dest& dest, const T_Src& src)
+{
+    algorithms::forEach::ForEach<typename T_Dest::ValueTypeSeq,
+        detail::DecodeIdentifier<bmpl::_1, T_ExchangeFormat> > decode;
+    decode(forward(dest), src);
+}
+
+} //namespace operations
+} //namespace particles
+} //namespace PMacc
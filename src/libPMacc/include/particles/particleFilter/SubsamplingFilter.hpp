@@ -0,0 +1,92 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of libPMacc.
+ *
+ * libPMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libPMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with libPMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+#include "particles/frame_types.hpp"
+#include "particles/memory/frames/NullFrame.hpp"
+
+namespace PMacc
+{
+
+/** select a fixed fraction of the particles
+ *
+ * The decision is a hash of the frame address, the particle index in the
+ * frame and a seed. It is reproducible as long as the particles are not
+ * moved in memory, thus counting and copying with the same filter select
+ * the same particles.
+ *
+ * The filter is disabled by default (all particles pass).
+ */
+template<class Base = NullFrame>
+class SubsamplingFilter : public Base
+{
+protected:
+    /* particles with a hash below threshold pass */
+    uint32_t subsamplingThreshold;
+    uint32_t subsamplingSeed;
+    bool subsamplingActive;
+
+public:
+
+    HDINLINE SubsamplingFilter() : subsamplingThreshold(0), subsamplingSeed(0), subsamplingActive(false)
+    {
+    }
+
+    /** set the fraction of selected particles
+     *
+     * @param rate fraction in [0,1], a rate >= 1 disables the filter
+     * @param seed seed of the hash, use the same seed for counting and copying
+     */
+    HDINLINE void setSubsampling(float rate, uint32_t seed)
+    {
+        subsamplingActive = rate < 1.0f;
+        subsamplingSeed = seed;
+        if (rate <= 0.0f)
+            subsamplingThreshold = 0;
+        else if (subsamplingActive)
+            subsamplingThreshold = (uint32_t) ((double) rate * 4294967295.0);
+    }
+
+    template<class FRAME>
+    HDINLINE bool operator()(FRAME & frame, lcellId_t id)
+    {
+        bool result = true;
+        if (subsamplingActive)
+        {
+            const uint64_t address = (uint64_t) (size_t) & frame;
+            /* finalizer of murmur3 */
+            uint32_t hash = (uint32_t) address ^ (uint32_t) (address >> 32) ^
+                (subsamplingSeed + id * 0x9e3779b9u);
+            hash ^= hash >> 16;
+            hash *= 0x85ebca6bu;
+            hash ^= hash >> 13;
+            hash *= 0xc2b2ae35u;
+            hash ^= hash >> 16;
+            result = hash < subsamplingThreshold;
+        }
+        return result && Base::operator() (frame, id);
+    }
+};
+
+} //namespace PMacc
@@ -42,10 +42,11 @@ namespace PMacc
          * Creates a TaskReceive.
          * @param ex Exchange to create new TaskReceive with
          * @param task_out returns the newly created task
+         * @param fillBorderGaps fill the gaps in BORDER after all particles are inserted
          * @param registeringTask optional pointer to an ITask which should be registered at the new task as an observer
          */
         template<class ParBase>
-        EventTask createTaskParticlesReceive(ParBase &parBuffer,
+        EventTask createTaskParticlesReceive(ParBase &parBuffer, bool fillBorderGaps = true,
         ITask *registeringTask = NULL);
 
         template<class ParBase>
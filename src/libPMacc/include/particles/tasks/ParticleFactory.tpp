@@ -35,10 +35,10 @@ namespace PMacc
 {
 
     template<class ParBase>
-    inline EventTask ParticleFactory::createTaskParticlesReceive(ParBase &parBase,
+    inline EventTask ParticleFactory::createTaskParticlesReceive(ParBase &parBase, bool fillBorderGaps,
     ITask *registeringTask)
     {
-        TaskParticlesReceive<ParBase>* task = new TaskParticlesReceive<ParBase > (parBase);
+        TaskParticlesReceive<ParBase>* task = new TaskParticlesReceive<ParBase > (parBase, fillBorderGaps);
 
         return Environment<>::get().Factory().startTask(*task, registeringTask);
     }
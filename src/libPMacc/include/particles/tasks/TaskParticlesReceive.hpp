@@ -41,8 +41,9 @@ namespace PMacc
             Exchanges = traits::NumberOfExchanges<Dim>::value
         };
 
-        TaskParticlesReceive(ParBase &parBase) :
+        TaskParticlesReceive(ParBase &parBase, bool fillBorderGaps = true) :
         parBase(parBase),
+        fillBorderGaps(fillBorderGaps),
         state(Constructor){ }
 
         virtual void init()
@@ -71,7 +72,7 @@ namespace PMacc
                     break;
                 case WaitForReceived:
                     if (NULL == Environment<>::get().Manager().getITaskIfNotFinished(tmpEvent.getTaskId()))
-                        state = CallFillGaps;
+                        state = fillBorderGaps ? CallFillGaps : Finish;
                     break;
                 case CallFillGaps:
                     state = WaitForFillGaps;
@@ -120,6 +121,7 @@ namespace PMacc
 
 
         ParBase& parBase;
+        bool fillBorderGaps;
         state_t state;
         EventTask tmpEvent;
 
@@ -24,8 +24,54 @@
 
 #pragma once
 
+#include <list>
+
+#include "dataManagement/ISimulationData.hpp"
+
 namespace PMacc
 {
+    /** dataset which is read during a notification */
+    struct DataDependency
+    {
+        /** memory in which the data is accessed */
+        enum Location
+        {
+            DEVICE, HOST
+        };
+
+        DataDependency(SimulationDataId id, Location location) :
+        id(id), location(location), hasRegion(false)
+        {
+        }
+
+        /** host dependency on a region of the data
+         *
+         * Only the region is synchronized before the notification,
+         * unless another object depends on the whole dataset.
+         *
+         * @param id dataset id
+         * @param region region in the index space of the data (\see ISimulationData::synchronizeRegion)
+         */
+        template<unsigned DIM>
+        DataDependency(SimulationDataId id, const Selection<DIM>& region) :
+        id(id), location(HOST), hasRegion(true)
+        {
+            for (uint32_t d = 0; d < DIM3; ++d)
+            {
+                this->region.offset[d] = d < DIM ? region.offset[d] : 0;
+                this->region.size[d] = d < DIM ? region.size[d] : 1;
+            }
+        }
+
+        SimulationDataId id;
+        Location location;
+        Selection<DIM3> region;
+        /* false: the whole dataset is accessed */
+        bool hasRegion;
+    };
+
+    typedef std::list<DataDependency> DataDependencies;
+
     /*
      * INotify interface.
      */
@@ -53,6 +99,25 @@ namespace PMacc
          */
         virtual void notify( uint32_t currentStep ) = 0;
 
+        /** Declare the datasets which are only read during notify()
+         *
+         * Host datasets are synchronized once for all notified objects
+         * before the first object which needs host data is notified.
+         * Objects with device dependencies only are notified while
+         * the host copies are in flight. The datasets are not copied
+         * on the device, the simulation continues after all due objects
+         * returned from notify().
+         *
+         * @param currentStep step of the upcoming notification
+         * @param dependencies list to add the dependencies to
+         * @return false if the dependencies are unknown (default),
+         *         the object is notified in registration order after all host data is ready
+         */
+        virtual bool getDataDependencies( uint32_t currentStep, DataDependencies& dependencies ) const
+        {
+            return false;
+        }
+
         /** When was the plugin notified last?
          *
          * @return last notify time step
@@ -26,6 +26,7 @@
 
 #include "pluginSystem/INotify.hpp"
 #include "pluginSystem/IPlugin.hpp"
+#include "memory/MemoryAccounting.hpp"
 
 namespace PMacc
 {
@@ -71,6 +72,8 @@ namespace PMacc
             {
                 if (!(*iter)->isLoaded())
                 {
+                    /* buffers which are created during load belong to the plugin */
+                    MemoryOwner owner((*iter)->pluginGetName());
                     (*iter)->load();
                 }
             }
@@ -137,6 +140,19 @@ namespace PMacc
          * @param currentStep current simulation iteration step
          */
         void notifyPlugins(uint32_t currentStep)
+        {
+            std::list<INotify*> dueList;
+            getDueNotifications(currentStep, dueList);
+            notifyPlugins(dueList, currentStep);
+        }
+
+        /**
+         * Get all objects which must be notified in a simulation step.
+         *
+         * @param currentStep current simulation iteration step
+         * @param dueList list to add the objects to (in registration order)
+         */
+        void getDueNotifications(uint32_t currentStep, std::list<INotify*>& dueList)
         {
             for (NotificationList::iterator iter = notificationList.begin();
                     iter != notificationList.end(); ++iter)
@@ -144,10 +160,23 @@ namespace PMacc
                 INotify* notifiedObj = iter->first;
                 uint32_t period = iter->second;
                 if (currentStep % period == 0)
-                {
-                    notifiedObj->notify(currentStep);
-                    notifiedObj->setLastNotify(currentStep);
-                }
+                    dueList.push_back(notifiedObj);
+            }
+        }
+
+        /**
+         * Notifies a list of objects that data should be dumped.
+         *
+         * @param dueList objects to notify, \see getDueNotifications
+         * @param currentStep current simulation iteration step
+         */
+        void notifyPlugins(std::list<INotify*>& dueList, uint32_t currentStep)
+        {
+            for (std::list<INotify*>::iterator iter = dueList.begin();
+                    iter != dueList.end(); ++iter)
+            {
+                (*iter)->notify(currentStep);
+                (*iter)->setLastNotify(currentStep);
             }
         }
 
@@ -26,6 +26,10 @@
 #include <cuda_runtime_api.h>
 #include <iostream>
 #include <iomanip>
+#include <list>
+#include <map>
+#include <set>
+#include <vector>
 
 #include "types.h"
 
@@ -123,7 +127,7 @@ public:
         Environment<DIM>::get().DataConnector().invalidate();
 
         /* trigger notification */
-        Environment<DIM>::get().PluginConnector().notifyPlugins(currentStep);
+        notifyPlugins(currentStep);
 
         /* trigger checkpoint notification */
         if (checkpointPeriod && (currentStep % checkpointPeriod == 0))
@@ -148,6 +152,84 @@ public:
         }
     }
 
+    /**
+     * Notify all plugins which are due in currentStep.
+     *
+     * Every host dataset declared by a plugin is copied once to the host,
+     * datasets which are only declared with regions copy these regions only.
+     * Plugins which only read device data run while these copies are in
+     * flight, all other plugins are notified after the copies finished.
+     * This only reorders the plugins around the host copies: all plugins
+     * are notified on the calling thread and the next step starts after
+     * the last plugin returned (no device snapshot of the datasets).
+     * Reductions which the plugins enqueued in the ReduceBatcher are started
+     * afterwards and finished with the next notification.
+     *
+     * @param currentStep simulation step
+     */
+    void notifyPlugins(uint32_t currentStep)
+    {
+        PluginConnector& pluginConnector = Environment<DIM>::get().PluginConnector();
+        DataConnector& dataConnector = Environment<DIM>::get().DataConnector();
+
+        std::list<INotify*> dueList;
+        pluginConnector.getDueNotifications(currentStep, dueList);
+
+        std::list<INotify*> deviceOnlyList;
+        std::list<INotify*> hostList;
+        std::set<SimulationDataId> hostData;
+        std::map<SimulationDataId, std::vector<Selection<DIM3> > > hostRegions;
+
+        for (std::list<INotify*>::iterator iter = dueList.begin(); iter != dueList.end(); ++iter)
+        {
+            DataDependencies dependencies;
+            bool needsHost = true;
+            if ((*iter)->getDataDependencies(currentStep, dependencies))
+            {
+                needsHost = false;
+                for (DataDependencies::iterator dep = dependencies.begin(); dep != dependencies.end(); ++dep)
+                {
+                    if (dep->location == DataDependency::HOST)
+                    {
+                        if (dep->hasRegion)
+                            hostRegions[dep->id].push_back(dep->region);
+                        else
+                            hostData.insert(dep->id);
+                        needsHost = true;
+                    }
+                }
+            }
+            if (needsHost)
+                hostList.push_back(*iter);
+            else
+                deviceOnlyList.push_back(*iter);
+        }
+
+        /* start one host copy per dataset, getData() of the plugins does not copy again */
+        for (std::set<SimulationDataId>::iterator iter = hostData.begin(); iter != hostData.end(); ++iter)
+        {
+            if (dataConnector.hasData(*iter))
+                dataConnector.getData<ISimulationData > (*iter);
+        }
+        typedef std::map<SimulationDataId, std::vector<Selection<DIM3> > > RegionMap;
+        for (RegionMap::iterator iter = hostRegions.begin(); iter != hostRegions.end(); ++iter)
+        {
+            if (hostData.count(iter->first) != 0 || !dataConnector.hasData(iter->first))
+                continue;
+            for (size_t i = 0; i < iter->second.size(); ++i)
+                dataConnector.getData<ISimulationData > (iter->first, iter->second[i]);
+        }
+
+        pluginConnector.notifyPlugins(deviceOnlyList, currentStep);
+
+        if (!hostData.empty() || !hostRegions.empty())
+            __getTransactionEvent().waitForFinished();
+
+        pluginConnector.notifyPlugins(hostList, currentStep);
+
+        Environment<DIM>::get().ReduceBatcher().flush();
+    }
+
     GridController<DIM> & getGridController()
     {
         return Environment<DIM>::get().GridController();
@@ -218,6 +300,8 @@ public:
 
         //simulatation end
         Environment<>::get().Manager().waitForAllTasks();
+        /* deliver the reductions of the last notification */
+        Environment<>::get().ReduceBatcher().finish();
 
         tSimCalculation.toggleEnd();
 
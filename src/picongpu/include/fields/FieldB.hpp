@@ -58,7 +58,11 @@ namespace picongpu
 
         typedef MappingDesc::SuperCellSize SuperCellSize;
 
-        FieldB( MappingDesc cellDescription);
+        /**
+         * @param stagedExchange exchange the guards in x, y, z stages with the
+         *        face neighbors only (\see GridBuffer::addStagedExchange)
+         */
+        FieldB( MappingDesc cellDescription, bool stagedExchange = false );
 
         virtual ~FieldB();
 
@@ -86,6 +90,8 @@ namespace picongpu
 
         void synchronize();
 
+        void synchronizeRegion(const Selection<DIM3>& region);
+
         void syncToDevice();
 
     private:
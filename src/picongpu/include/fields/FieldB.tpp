@@ -56,7 +56,7 @@ namespace picongpu
 
 using namespace PMacc;
 
-FieldB::FieldB( MappingDesc cellDescription ) :
+FieldB::FieldB( MappingDesc cellDescription, bool stagedExchange ) :
 SimulationFieldHelper<MappingDesc>( cellDescription ),
 fieldE( NULL )
 {
@@ -88,6 +88,12 @@ fieldE( NULL )
     const DataSpace<simDim> originGuard( LowerMargin( ).toRT( ) );
     const DataSpace<simDim> endGuard( UpperMargin( ).toRT( ) );
 
+    if ( stagedExchange )
+    {
+        fieldB->addStagedExchange( originGuard, endGuard, FIELD_B );
+        return;
+    }
+
     /*go over all directions*/
     for ( uint32_t i = 1; i < NumberOfExchanges<simDim>::value; ++i )
     {
@@ -119,6 +125,11 @@ void FieldB::synchronize( )
     fieldB->deviceToHost( );
 }
 
+void FieldB::synchronizeRegion( const Selection<DIM3>& region )
+{
+    fieldB->deviceToHost( region );
+}
+
 void FieldB::syncToDevice( )
 {
 
@@ -58,7 +58,11 @@ namespace picongpu
         typedef DataBox<PitchedBox<ValueType, simDim> > DataBoxType;
 
 
-        FieldE(MappingDesc cellDescription);
+        /**
+         * @param stagedExchange exchange the guards in x, y, z stages with the
+         *        face neighbors only (\see GridBuffer::addStagedExchange)
+         */
+        FieldE( MappingDesc cellDescription, bool stagedExchange = false );
 
         virtual ~FieldE();
 
@@ -86,6 +90,8 @@ namespace picongpu
 
         void synchronize();
 
+        void synchronizeRegion(const Selection<DIM3>& region);
+
         void syncToDevice();
 
         void laserManipulation(uint32_t currentStep);
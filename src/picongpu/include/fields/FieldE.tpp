@@ -52,7 +52,7 @@ namespace picongpu
 {
 using namespace PMacc;
 
-FieldE::FieldE( MappingDesc cellDescription ) :
+FieldE::FieldE( MappingDesc cellDescription, bool stagedExchange ) :
 SimulationFieldHelper<MappingDesc>( cellDescription ),
 fieldB( NULL )
 {
@@ -83,6 +83,12 @@ fieldB( NULL )
     const DataSpace<simDim> originGuard( LowerMargin( ).toRT( ) );
     const DataSpace<simDim> endGuard( UpperMargin( ).toRT( ) );
 
+    if ( stagedExchange )
+    {
+        fieldE->addStagedExchange( originGuard, endGuard, FIELD_E );
+        return;
+    }
+
     /*receive from all directions*/
     for ( uint32_t i = 1; i < NumberOfExchanges<simDim>::value; ++i )
     {
@@ -113,6 +119,11 @@ void FieldE::synchronize( )
     fieldE->deviceToHost( );
 }
 
+void FieldE::synchronizeRegion( const Selection<DIM3>& region )
+{
+    fieldE->deviceToHost( region );
+}
+
 void FieldE::syncToDevice( )
 {
     fieldE->hostToDevice( );
@@ -70,6 +70,11 @@ public:
 
     virtual EventTask asyncCommunication(EventTask serialEvent);
 
+    /** same as asyncCommunication(serialEvent), but all exchanges are part
+     * of the aggregated messages of phase (\see ExchangePhase)
+     */
+    EventTask asyncCommunication(EventTask serialEvent, ExchangePhase &phase);
+
     void init(FieldE &fieldE);
 
     GridLayout<simDim> getGridLayout();
@@ -94,6 +99,8 @@ public:
 
     void synchronize();
 
+    void synchronizeRegion(const Selection<DIM3>& region);
+
     void syncToDevice()
     {
         ValueType tmp = float3_X(0., 0., 0.);
@@ -123,6 +130,12 @@ public:
 
 private:
 
+    /* deposit the current of all particles in AREA to jBox
+     * @param deltaTime time step of the last push of the particles
+     */
+    template<uint32_t AREA, class ParticlesClass>
+    void depositCurrent(ParticlesClass &parClass, DataBoxType jBox, const float_X deltaTime);
+
     GridBuffer<ValueType, simDim> fieldJ;
 
     FieldE *fieldE;
@@ -42,6 +42,7 @@
 #include <boost/mpl/accumulate.hpp>
 #include "traits/GetMargin.hpp"
 #include "particles/traits/GetCurrentSolver.hpp"
+#include "particles/traits/GetSubcycling.hpp"
 
 
 namespace picongpu
@@ -116,6 +117,11 @@ void FieldJ::synchronize( )
     fieldJ.deviceToHost( );
 }
 
+void FieldJ::synchronizeRegion( const Selection<DIM3>& region )
+{
+    fieldJ.deviceToHost( region );
+}
+
 GridBuffer<FieldJ::ValueType, simDim> &FieldJ::getGridBuffer( )
 {
     return fieldJ;
@@ -134,6 +140,19 @@ EventTask FieldJ::asyncCommunication( EventTask serialEvent )
     return ret;
 }
 
+EventTask FieldJ::asyncCommunication( EventTask serialEvent, ExchangePhase &phase )
+{
+    EventTask ret;
+    __startTransaction( serialEvent );
+    FieldFactory::getInstance( ).createTaskFieldReceiveAndInsert( *this, &phase );
+    ret = __endTransaction( );
+
+    __startTransaction( serialEvent );
+    FieldFactory::getInstance( ).createTaskFieldSend( *this, &phase );
+    ret += __endTransaction( );
+    return ret;
+}
+
 void FieldJ::bashField( uint32_t exchangeType )
 {
     ExchangeMapping<GUARD, MappingDesc> mapper( this->cellDescription, exchangeType );
@@ -208,7 +227,35 @@ FieldJ::getCommTag( )
 }
 
 template<uint32_t AREA, class ParticlesClass>
-void FieldJ::computeCurrent( ParticlesClass &parClass, uint32_t ) throw (std::invalid_argument )
+void FieldJ::computeCurrent( ParticlesClass &parClass, uint32_t currentStep ) throw (std::invalid_argument )
+{
+    const uint32_t subcycling = GetSubcycling<ParticlesClass>::value;
+    if ( subcycling == 1 )
+    {
+        depositCurrent<AREA>( parClass, this->fieldJ.getDeviceBuffer( ).getDataBox( ), DELTA_T );
+        return;
+    }
+
+    /* a subcycled species deposits the mean current of its push once,
+     * this current is added on every step until the next push */
+    GridBuffer<ValueType, simDim>& heldCurrent = parClass.getHeldCurrent( );
+    if ( parClass.isPushStep( currentStep ) )
+    {
+        heldCurrent.getDeviceBuffer( ).setValue( ValueType( 0., 0., 0. ) );
+        depositCurrent<AREA>( parClass, heldCurrent.getDeviceBuffer( ).getDataBox( ),
+                              float_X( subcycling ) * DELTA_T );
+    }
+
+    __picKernelArea( ( kernelAddHeldCurrent ),
+                     cellDescription,
+                     CORE + BORDER + GUARD )
+        ( MappingDesc::SuperCellSize::toRT( ).toDim3() )
+        ( this->fieldJ.getDeviceBuffer( ).getDataBox( ),
+          heldCurrent.getDeviceBuffer( ).getDataBox( ) );
+}
+
+template<uint32_t AREA, class ParticlesClass>
+void FieldJ::depositCurrent( ParticlesClass &parClass, DataBoxType jBox, const float_X deltaTime )
 {
     /** tune paramter to use more threads than cells in a supercell
      *  valid domain: 1 <= workerMultiplier
@@ -228,8 +275,7 @@ void FieldJ::computeCurrent( ParticlesClass &parClass, uint32_t ) throw (std::in
 
     StrideMapping<AREA, simDim, MappingDesc> mapper( cellDescription );
     typename ParticlesClass::ParticlesBoxType pBox = parClass.getDeviceParticlesBox( );
-    FieldJ::DataBoxType jBox = this->fieldJ.getDeviceBuffer( ).getDataBox( );
-    FrameSolver solver( DELTA_T );
+    FrameSolver solver( deltaTime );
 
     DataSpace<simDim> blockSize( mapper.getSuperCellSize( ) );
     blockSize[simDim-1]*=workerMultiplier;
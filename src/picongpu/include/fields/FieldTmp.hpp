@@ -94,6 +94,8 @@ namespace picongpu
 
         void synchronize( );
 
+        void synchronizeRegion(const Selection<DIM3>& region);
+
         void syncToDevice( );
 
         /* Bash particles in a direction.
@@ -190,6 +190,11 @@ namespace picongpu
         fieldTmp->deviceToHost( );
     }
 
+    void FieldTmp::synchronizeRegion( const Selection<DIM3>& region )
+    {
+        fieldTmp->deviceToHost( region );
+    }
+
     void FieldTmp::syncToDevice( )
     {
         fieldTmp->hostToDevice( );
@@ -54,10 +54,22 @@ private:
                 cursor::make_NestedCursor(cursorB),
                 DirSplittingKernel<BlockDim>((int)gridSize.x()));
     }
+
+    /* exchange the guards of E and B with one message per neighbor */
+    void communicateFields(FieldE& fieldE, FieldB& fieldB) const
+    {
+        ExchangePhase phase;
+        EventTask eRfields = fieldE.getGridBuffer().asyncCommunication(__getTransactionEvent(), phase) +
+            fieldB.getGridBuffer().asyncCommunication(__getTransactionEvent(), phase);
+        phase.close();
+        __setTransactionEvent(eRfields);
+    }
 public:
     DirSplitting(MappingDesc) {}
 
-    void update_beforeCurrent(uint32_t currentStep) const
+    /* every propagation needs the guards of the previous one,
+     * the exchanges can not join phase */
+    void update_beforeCurrent(uint32_t currentStep, ExchangePhase&) const
     {
         typedef SuperCellSize GuardDim;
 
@@ -84,16 +96,14 @@ public:
                   fieldB_coreBorder.origin(),
                   fieldE_coreBorder.size());
 
-        __setTransactionEvent(fieldE.asyncCommunication(__getTransactionEvent()));
-        __setTransactionEvent(fieldB.asyncCommunication(__getTransactionEvent()));
+        communicateFields(fieldE, fieldB);
 
         typedef PMacc::math::CT::Int<1,2,0> Orientation_Y;
         propagate(twistVectorFieldAxes<Orientation_Y>(fieldE_coreBorder.origin()),
                   twistVectorFieldAxes<Orientation_Y>(fieldB_coreBorder.origin()),
                   twistVectorAxes<Orientation_Y>(gridSize));
 
-        __setTransactionEvent(fieldE.asyncCommunication(__getTransactionEvent()));
-        __setTransactionEvent(fieldB.asyncCommunication(__getTransactionEvent()));
+        communicateFields(fieldE, fieldB);
 
         typedef PMacc::math::CT::Int<2,0,1> Orientation_Z;
         propagate(twistVectorFieldAxes<Orientation_Z>(fieldE_coreBorder.origin()),
@@ -103,10 +113,12 @@ public:
         if (laserProfile::INIT_TIME > float_X(0.0))
             dc.getData<FieldE > (FieldE::getName(), true).laserManipulation(currentStep);
 
-        __setTransactionEvent(fieldE.asyncCommunication(__getTransactionEvent()));
-        __setTransactionEvent(fieldB.asyncCommunication(__getTransactionEvent()));
+        communicateFields(fieldE, fieldB);
     }
 
+    void update_beforeCurrentBorder(uint32_t) const
+    {    }
+
     void update_afterCurrent(uint32_t) const
     {    }
 };
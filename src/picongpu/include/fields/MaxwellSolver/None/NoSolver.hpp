@@ -26,6 +26,7 @@
 
 #include "types.h"
 #include "simulation_defines.hpp"
+#include "communication/ExchangeAggregator.hpp"
 
 
 namespace picongpu
@@ -61,7 +62,12 @@ namespace picongpu
 
             }
 
-            void update_beforeCurrent(uint32_t)
+            void update_beforeCurrent(uint32_t, ExchangePhase&)
+            {
+
+            }
+
+            void update_beforeCurrentBorder(uint32_t)
             {
 
             }
@@ -60,6 +60,8 @@ private:
     FieldE* fieldE;
     FieldB* fieldB;
     MappingDesc cellDescription;
+    /* guards of B which are needed by updateE<BORDER> */
+    EventTask eRfieldBBeforeCurrent;
 
     template<uint32_t AREA>
     void updateE()
@@ -100,13 +102,21 @@ public:
         this->fieldB = &dc.getData<FieldB > (FieldB::getName(), true);
     }
 
-    void update_beforeCurrent(uint32_t)
+    /** the guards of B are exchanged as part of phase,
+     * the border of E is updated in update_beforeCurrentBorder
+     */
+    void update_beforeCurrent(uint32_t, ExchangePhase &phase)
     {
         updateBHalf < CORE+BORDER >();
-        EventTask eRfieldB = fieldB->asyncCommunication(__getTransactionEvent());
+        eRfieldBBeforeCurrent = fieldB->getGridBuffer().asyncCommunication(__getTransactionEvent(), phase);
 
         updateE<CORE>();
-        __setTransactionEvent(eRfieldB);
+    }
+
+    /** must be called after the phase of update_beforeCurrent is closed */
+    void update_beforeCurrentBorder(uint32_t)
+    {
+        __setTransactionEvent(eRfieldBBeforeCurrent);
         updateE<BORDER>();
     }
 
@@ -60,6 +60,7 @@ struct Esirkepov<T_ParticleShape, DIM3>
     static const int end = begin + supp + 1;
 
     float_X charge;
+    float_X deltaTime;
 
     /* At the moment Esirkepov only support YeeCell were W is defined at origin (0,0,0)
      *
@@ -73,6 +74,7 @@ struct Esirkepov<T_ParticleShape, DIM3>
                             const float_X deltaTime)
     {
         this->charge = charge;
+        this->deltaTime = deltaTime;
         const float3_X deltaPos = float3_X(velocity.x() * deltaTime / cellSize.x(),
                                            velocity.y() * deltaTime / cellSize.y(),
                                            velocity.z() * deltaTime / cellSize.z());
@@ -167,7 +169,7 @@ struct Esirkepov<T_ParticleShape, DIM3>
                 for (int k = begin + offset_k; k < end + offset_k; ++k)
                 {
                     float_X W = DS(line, k, 2) * tmp;
-                    accumulated_J += -this->charge * (float_X(1.0) / float_X(CELL_VOLUME * DELTA_T)) * W * cellEdgeLength;
+                    accumulated_J += -this->charge * (float_X(1.0) / float_X(CELL_VOLUME * this->deltaTime)) * W * cellEdgeLength;
                     /* the branch divergence here still over-compensates for the fewer collisions in the (expensive) atomic adds */
                     if (accumulated_J != float_X(0.0))
                         atomicAddWrapper(&((*cursorJ(i, j, k)).z()), accumulated_J);
@@ -68,6 +68,7 @@ struct Esirkepov<T_ParticleShape, DIM2>
     static const int end = begin + supp + 1;
 
     float_X charge;
+    float_X deltaTime;
 
     template<typename DataBoxJ, typename PosType, typename VelType, typename ChargeType >
     DINLINE void operator()(DataBoxJ dataBoxJ,
@@ -76,6 +77,7 @@ struct Esirkepov<T_ParticleShape, DIM2>
                             const ChargeType charge, const float_X deltaTime)
     {
         this->charge = charge;
+        this->deltaTime = deltaTime;
         const float2_X deltaPos = float2_X(velocity.x() * deltaTime / cellSize.x(),
                                            velocity.y() * deltaTime / cellSize.y());
         const PosType oldPos = pos - deltaPos;
@@ -163,7 +165,7 @@ struct Esirkepov<T_ParticleShape, DIM2>
             for (int i = begin + offset_i; i < end + offset_i; ++i)
             {
                 float_X W = DS(line, i, 0) * tmp;
-                accumulated_J += -this->charge * (float_X(1.0) / float_X(CELL_VOLUME * DELTA_T)) * W * cellEdgeLength;
+                accumulated_J += -this->charge * (float_X(1.0) / float_X(CELL_VOLUME * this->deltaTime)) * W * cellEdgeLength;
                 /* the branch divergence here still over-compensates for the fewer collisions in the (expensive) atomic adds */
                 if (accumulated_J != float_X(0.0))
                     atomicAddWrapper(&((*cursorJ(i, j)).x()), accumulated_J);
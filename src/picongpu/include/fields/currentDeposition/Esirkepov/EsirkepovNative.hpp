@@ -63,6 +63,7 @@ struct EsirkepovNative
     static const int end = currentUpperMargin + 1;
 
     float_X charge;
+    float_X deltaTime;
 
     /* At the moment Esirkepov only support YeeCell were W is defined at origin (0,0,0)
      *
@@ -75,6 +76,7 @@ struct EsirkepovNative
                             const ChargeType charge, const float_X deltaTime)
     {
         this->charge = charge;
+        this->deltaTime = deltaTime;
         const float3_X deltaPos = float3_X(velocity.x() * deltaTime / cellSize.x(),
                                            velocity.y() * deltaTime / cellSize.y(),
                                            velocity.z() * deltaTime / cellSize.z());
@@ -124,7 +126,7 @@ struct EsirkepovNative
                 for (int k = begin; k < end; ++k)
                 {
                     float_X W = DS(line, k, 3) * tmp;
-                    accumulated_J += -this->charge * (float_X(1.0) / float_X(CELL_VOLUME * DELTA_T)) * W * cellEdgeLength;
+                    accumulated_J += -this->charge * (float_X(1.0) / float_X(CELL_VOLUME * this->deltaTime)) * W * cellEdgeLength;
                     atomicAddWrapper(&((*cursorJ(i, j, k)).z()), accumulated_J);
                 }
             }
@@ -24,6 +24,7 @@
 #define	_FIELDFACTORY_HPP
 
 #include "memory/buffers/Exchange.hpp"
+#include "communication/ExchangeAggregator.hpp"
 
 #include "eventSystem/tasks/Factory.hpp"
 #include "eventSystem/tasks/ITask.hpp"
@@ -44,28 +45,34 @@ namespace PMacc
          * Creates a TaskReceive.
          * @param ex Exchange to create new TaskReceive with
          * @param task_out returns the newly created task
+         * @param phase if not NULL the exchanges are received as part of the aggregated messages of phase
          * @param registeringTask optional pointer to an ITask which should be registered at the new task as an observer
          */
         template<class Field>
         EventTask createTaskFieldReceiveAndInsert(Field &buffer,
+        ExchangePhase *phase = NULL,
         ITask *registeringTask = NULL);
 
         template<class Field>
         EventTask createTaskFieldReceiveAndInsertExchange(Field &buffer, uint32_t exchange,
+        ExchangePhase *phase = NULL,
         ITask *registeringTask = NULL);
 
         /**
          * Creates a TaskSend.
          * @param ex Exchange to create new TaskSend with
          * @param task_in TaskReceive to register at new TaskSend
+         * @param phase if not NULL the exchanges are sent as part of the aggregated messages of phase
          * @param registeringTask optional pointer to an ITask which should be registered at the new task as an observer
          */
         template<class Field>
         EventTask createTaskFieldSend(Field &buffer,
+        ExchangePhase *phase = NULL,
         ITask *registeringTask = NULL);
 
         template<class Field>
         EventTask createTaskFieldSendExchange(Field &buffer, uint32_t exchange,
+        ExchangePhase *phase = NULL,
         ITask *registeringTask = NULL);
 
         /**
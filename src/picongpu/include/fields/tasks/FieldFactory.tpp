@@ -33,36 +33,40 @@ namespace PMacc
 
     template<class Field>
     inline EventTask FieldFactory::createTaskFieldReceiveAndInsert(Field &buffer,
+                                                                   ExchangePhase *phase,
                                                                    ITask *registeringTask)
     {
-        TaskFieldReceiveAndInsert<Field>* task = new TaskFieldReceiveAndInsert<Field > (buffer);
+        TaskFieldReceiveAndInsert<Field>* task = new TaskFieldReceiveAndInsert<Field > (buffer, phase);
 
         return Environment<>::get().Factory().startTask(*task, registeringTask);
     }
 
     template<class Field>
     inline EventTask FieldFactory::createTaskFieldReceiveAndInsertExchange(Field &buffer, uint32_t exchange,
+                                                                           ExchangePhase *phase,
                                                                            ITask *registeringTask)
     {
-        TaskFieldReceiveAndInsertExchange<Field>* task = new TaskFieldReceiveAndInsertExchange<Field > (buffer, exchange);
+        TaskFieldReceiveAndInsertExchange<Field>* task = new TaskFieldReceiveAndInsertExchange<Field > (buffer, exchange, phase);
 
         return Environment<>::get().Factory().startTask(*task, registeringTask);
     }
 
     template<class Field>
     inline EventTask FieldFactory::createTaskFieldSend(Field &buffer,
+                                                       ExchangePhase *phase,
                                                        ITask *registeringTask)
     {
-        TaskFieldSend<Field>* task = new TaskFieldSend<Field > (buffer);
+        TaskFieldSend<Field>* task = new TaskFieldSend<Field > (buffer, phase);
 
         return Environment<>::get().Factory().startTask(*task, registeringTask);
     }
 
     template<class Field>
     inline EventTask FieldFactory::createTaskFieldSendExchange(Field &buffer, uint32_t exchange,
+                                                               ExchangePhase *phase,
                                                                ITask *registeringTask)
     {
-        TaskFieldSendExchange<Field>* task = new TaskFieldSendExchange<Field > (buffer, exchange);
+        TaskFieldSendExchange<Field>* task = new TaskFieldSendExchange<Field > (buffer, exchange, phase);
 
         return Environment<>::get().Factory().startTask(*task, registeringTask);
     }
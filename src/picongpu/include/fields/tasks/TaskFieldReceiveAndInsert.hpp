@@ -41,9 +41,13 @@ public:
 
     static const uint32_t Dim = picongpu::simDim;
 
-    TaskFieldReceiveAndInsert(Field &buffer) :
+    /**
+     * @param phase if not NULL the exchanges are received as part of the aggregated messages of phase
+     */
+    TaskFieldReceiveAndInsert(Field &buffer, ExchangePhase *phase = NULL) :
     buffer(buffer),
-    state(Constructor)
+    state(Constructor),
+    phase(phase)
     {
     }
 
@@ -57,7 +61,7 @@ public:
             if (buffer.getGridBuffer().hasReceiveExchange(i))
             {
                 __startAtomicTransaction(serialEvent);
-                FieldFactory::getInstance().createTaskFieldReceiveAndInsertExchange(buffer, i);
+                FieldFactory::getInstance().createTaskFieldReceiveAndInsertExchange(buffer, i, phase);
                 tmpEvent += __endTransaction();
             }
         }
@@ -139,6 +143,7 @@ private:
     Field& buffer;
     state_t state;
     EventTask tmpEvent;
+    ExchangePhase *phase;
 
 };
 
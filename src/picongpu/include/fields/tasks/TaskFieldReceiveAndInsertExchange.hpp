@@ -40,18 +40,19 @@ class TaskFieldReceiveAndInsertExchange : public MPITask
 {
 public:
 
-    TaskFieldReceiveAndInsertExchange(Field &buffer, uint32_t exchange) :
+    TaskFieldReceiveAndInsertExchange(Field &buffer, uint32_t exchange, ExchangePhase *phase = NULL) :
     buffer(buffer),
     exchange(exchange),
     state(Constructor),
-    initDependency(__getTransactionEvent())
+    initDependency(__getTransactionEvent()),
+    phase(phase)
     {
     }
 
     virtual void init()
     {
         state = Init;
-        initDependency = buffer.getGridBuffer().asyncReceive(initDependency, exchange);
+        initDependency = buffer.getGridBuffer().asyncReceive(initDependency, exchange, phase);
         state = WaitForReceive;
     }
 
@@ -112,6 +113,7 @@ private:
     EventTask insertEvent;
     EventTask initDependency;
     uint32_t exchange;
+    ExchangePhase *phase;
 };
 
 } //namespace PMacc
@@ -41,9 +41,13 @@ namespace PMacc
             Dim = picongpu::simDim
         };
 
-        TaskFieldSend(Field &buffer) :
+        /**
+         * @param phase if not NULL the exchanges are sent as part of the aggregated messages of phase
+         */
+        TaskFieldSend(Field &buffer, ExchangePhase *phase = NULL) :
         buffer(buffer),
-        state(Constructor) { }
+        state(Constructor),
+        phase(phase) { }
 
         virtual void init()
         {
@@ -55,7 +59,7 @@ namespace PMacc
                 if (buffer.getGridBuffer().hasSendExchange(i))
                 {
                     __startAtomicTransaction(serialEvent);
-                    FieldFactory::getInstance().createTaskFieldSendExchange(buffer, i);
+                    FieldFactory::getInstance().createTaskFieldSendExchange(buffer, i, phase);
                     tmpEvent += __endTransaction();
                 }
             }
@@ -103,6 +107,7 @@ namespace PMacc
         Field& buffer;
         state_t state;
         EventTask tmpEvent;
+        ExchangePhase *phase;
     };
 
 } //namespace PMacc
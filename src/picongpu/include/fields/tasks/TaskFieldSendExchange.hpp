@@ -40,11 +40,15 @@ namespace PMacc
     {
     public:
 
-        TaskFieldSendExchange(Field &buffer, uint32_t exchange) :
+        /**
+         * @param phase if not NULL the exchange is sent as part of the aggregated messages of phase
+         */
+        TaskFieldSendExchange(Field &buffer, uint32_t exchange, ExchangePhase *phase = NULL) :
         buffer(buffer),
         exchange(exchange),
         state(Constructor),
-        initDependency(__getTransactionEvent())
+        initDependency(__getTransactionEvent()),
+        phase(phase)
         {
         }
 
@@ -55,6 +59,15 @@ namespace PMacc
             buffer.bashField(exchange);
             initDependency = __endTransaction();
             state = WaitForBash;
+
+            /* the exchange must join the phase before it is closed,
+             * therefore the send is started behind the bash kernel here */
+            if (phase != NULL)
+            {
+                EventTask bashEvent = initDependency;
+                sendEvent = buffer.getGridBuffer().asyncSend(bashEvent, exchange, initDependency, phase);
+                state = WaitForSendEnd;
+            }
         }
 
         bool executeIntern()
@@ -124,6 +137,7 @@ namespace PMacc
         EventTask sendEvent;
         EventTask initDependency;
         uint32_t exchange;
+        ExchangePhase *phase;
     };
 
 } //namespace PMacc
@@ -28,6 +28,9 @@
 #include "particles/memory/buffers/ParticlesBuffer.hpp"
 
 #include "dataManagement/ISimulationData.hpp"
+#include "memory/buffers/GridBuffer.hpp"
+#include "eventSystem/EventSystem.hpp"
+#include "simulationControl/TimeInterval.hpp"
 
 #include <curand_kernel.h>
 
@@ -58,8 +61,36 @@ public:
 
     void init(FieldE &fieldE, FieldB &fieldB, FieldJ &fieldJ, FieldTmp &fieldTmp);
 
+    /** push all particles and start the particle exchange
+     *
+     * BORDER is pushed first and its leaving particles are exchanged while
+     * CORE is pushed. The transaction event of the caller is the finished
+     * push, finishUpdate() must be called afterwards.
+     */
     void update(uint32_t currentStep);
 
+    /** shift the particles after the exchange of update() is finished */
+    void finishUpdate(uint32_t currentStep);
+
+    /** true if the species is pushed in currentStep
+     *
+     * a species with subcycling k is pushed every k-th step with k * DELTA_T
+     */
+    bool isPushStep(uint32_t currentStep) const;
+
+    /** current of the last push of a subcycled species
+     *
+     * only valid if the species has a subcycling > 1
+     */
+    GridBuffer<float3_X, simDim>& getHeldCurrent();
+
+    /** time averaged E and B since the last push of a subcycled species
+     *
+     * only valid if the species has a subcycling > 1
+     */
+    GridBuffer<float3_X, simDim>& getAveragedE();
+    GridBuffer<float3_X, simDim>& getAveragedB();
+
     void initFill(uint32_t currentStep);
 
     template< typename t_ParticleDescription>
@@ -76,6 +107,22 @@ public:
     void syncToDevice();
 
 private:
+
+    /** merge and split macro particles with the thresholds of the flag resampling<>
+     *
+     * called by update() before the push if the resampling period is due
+     */
+    void resample(uint32_t currentStep);
+
+    /** create particles with exact frame allocation
+     *
+     * counts the macro particles per supercell, reserves all needed frames
+     * with one prefix sum and fills them without gaps
+     */
+    template< typename T_FieldBox>
+    void fillGridExact(DataSpace<simDim> gpuCellOffset, uint32_t seed, uint32_t currentStep,
+                       uint32_t gNrCellsY, T_FieldBox fieldBox);
+
     SimulationDataId datasetID;
     GridLayout<simDim> gridLayout;
 
@@ -86,6 +133,16 @@ private:
     FieldTmp *fieldTmp;
 
     curandState* randState;
+
+    /* time averaged fields since the last push of a subcycled species (else NULL) */
+    GridBuffer<float3_X, simDim> *averagedE;
+    GridBuffer<float3_X, simDim> *averagedB;
+    /* current of the last push, added to FieldJ on every step (else NULL) */
+    GridBuffer<float3_X, simDim> *heldCurrent;
+
+    /* particle exchange started by update() */
+    EventTask exchangeEvent;
+    TimeIntervall tExchange;
 };
 
 
@@ -22,6 +22,8 @@
 #pragma once
 
 #include <iostream>
+#include <sstream>
+#include <stdexcept>
 
 #include "simulation_defines.hpp"
 #include "Particles.hpp"
@@ -44,6 +46,7 @@
 #include "mpi/SeedPerRank.hpp"
 
 #include "simulationControl/MovingWindow.hpp"
+#include "simulationControl/TimeInterval.hpp"
 
 #include <assert.h>
 #include <limits>
@@ -51,6 +54,10 @@
 #include "fields/numericalCellTypes/YeeCell.hpp"
 
 #include "particles/traits/GetPusher.hpp"
+#include "particles/traits/GetSubcycling.hpp"
+#include "particles/traits/GetResampling.hpp"
+#include "particles/resampling/Resampling.kernel"
+#include "particles/operations/CountParticles.hpp"
 
 namespace picongpu
 {
@@ -64,8 +71,21 @@ Particles<T_ParticleDescription>::Particles( GridLayout<simDim> gridLayout,
                                              SimulationDataId datasetID) :
 ParticlesBase<T_ParticleDescription, MappingDesc>( cellDescription ),
 fieldB( NULL ), fieldE( NULL ), fieldJurrent( NULL ), fieldTmp( NULL ), gridLayout( gridLayout ),
-datasetID( datasetID )
+datasetID( datasetID ), averagedE( NULL ), averagedB( NULL ), heldCurrent( NULL )
 {
+    if ( GetSubcycling<Particles>::value > 1 )
+    {
+        const float3_X zero( 0., 0., 0. );
+        averagedE = new GridBuffer<float3_X, simDim > ( gridLayout );
+        averagedB = new GridBuffer<float3_X, simDim > ( gridLayout );
+        heldCurrent = new GridBuffer<float3_X, simDim > ( gridLayout );
+        averagedE->getDeviceBuffer( ).setValue( zero );
+        averagedB->getDeviceBuffer( ).setValue( zero );
+        heldCurrent->getDeviceBuffer( ).setValue( zero );
+        log<picLog::PHYSICS > ( "species %1% is pushed every %2% steps" ) %
+            FrameType::getName( ) % GetSubcycling<Particles>::value;
+    }
+
     size_t sizeOfExchanges = 2 * 2 * ( BYTES_EXCHANGE_X + BYTES_EXCHANGE_Y + BYTES_EXCHANGE_Z ) + BYTES_EXCHANGE_X * 2 * 8;
 
 
@@ -99,11 +119,7 @@ datasetID( datasetID )
 template< typename T_ParticleDescription>
 void Particles<T_ParticleDescription>::createParticleBuffer( size_t gpuMemory )
 {
-
-    /*!\todo: this is the 4GB fix for GPUs with more than 4GB memory*/
-    if ( gpuMemory >= UINT_MAX )
-        gpuMemory = (size_t) ( UINT_MAX - 2 );
-
+    /* the number of frames is limited by the frame index type (see vint_t) */
     this->particlesBuffer->createParticleBuffer( gpuMemory );
 
 }
@@ -112,6 +128,36 @@ template< typename T_ParticleDescription>
 Particles<T_ParticleDescription>::~Particles( )
 {
     delete this->particlesBuffer;
+    __delete( averagedE );
+    __delete( averagedB );
+    __delete( heldCurrent );
+}
+
+template< typename T_ParticleDescription>
+bool Particles<T_ParticleDescription>::isPushStep( uint32_t currentStep ) const
+{
+    return ( currentStep + 1 ) % GetSubcycling<Particles>::value == 0;
+}
+
+template< typename T_ParticleDescription>
+GridBuffer<float3_X, simDim>& Particles<T_ParticleDescription>::getHeldCurrent( )
+{
+    assert( heldCurrent != NULL );
+    return *heldCurrent;
+}
+
+template< typename T_ParticleDescription>
+GridBuffer<float3_X, simDim>& Particles<T_ParticleDescription>::getAveragedE( )
+{
+    assert( averagedE != NULL );
+    return *averagedE;
+}
+
+template< typename T_ParticleDescription>
+GridBuffer<float3_X, simDim>& Particles<T_ParticleDescription>::getAveragedB( )
+{
+    assert( averagedB != NULL );
+    return *averagedB;
 }
 
 template< typename T_ParticleDescription>
@@ -144,7 +190,7 @@ void Particles<T_ParticleDescription>::init( FieldE &fieldE, FieldB &fieldB, Fie
 }
 
 template<typename T_ParticleDescription>
-void Particles<T_ParticleDescription>::update(uint32_t )
+void Particles<T_ParticleDescription>::update(uint32_t currentStep)
 {
     typedef typename HasFlag<FrameType,particlePusher<> >::type hasPusher;
     typedef typename GetFlagType<FrameType,particlePusher<> >::type FoundPusher;
@@ -170,26 +216,157 @@ void Particles<T_ParticleDescription>::update(uint32_t )
 
     dim3 block( MappingDesc::SuperCellSize::toRT().toDim3() );
 
-    __picKernelArea( kernelMoveAndMarkParticles<BlockArea>, this->cellDescription, CORE + BORDER )
+    const uint32_t subcycling = GetSubcycling<Particles>::value;
+    FieldE::DataBoxType eBox = this->fieldE->getDeviceDataBox( );
+    FieldB::DataBoxType bBox = this->fieldB->getDeviceDataBox( );
+
+    if ( subcycling > 1 )
+    {
+        /* collect the time average of the fields since the last push */
+        __picKernelArea( kernelAverageFields, this->cellDescription, CORE + BORDER + GUARD )
+            (block)
+            ( averagedE->getDeviceBuffer( ).getDataBox( ),
+              averagedB->getDeviceBuffer( ).getDataBox( ),
+              eBox,
+              bBox,
+              float_X( 1.0 ) / float_X( subcycling ),
+              currentStep % subcycling == 0 );
+
+        if ( !isPushStep( currentStep ) )
+        {
+            exchangeEvent = EventTask( );
+            return;
+        }
+        eBox = averagedE->getDeviceBuffer( ).getDataBox( );
+        bBox = averagedB->getDeviceBuffer( ).getDataBox( );
+    }
+
+    typedef typename GetResampling<Particles>::type Resampling;
+    if ( Resampling::period != 0 && currentStep % Resampling::period == 0 )
+        resample( currentStep );
+
+    const FrameSolver frameSolver( float_X( subcycling ) * DELTA_T );
+
+    /* the push only visits supercells with particles, the list is fetched before
+     * the exchange adds particles to BORDER (received particles are pushed next step) */
+    const ActiveSuperCellList activeSuperCells( this->getActiveSuperCells( ) );
+
+    __picKernelActiveArea( kernelMoveAndMarkParticles<BlockArea>, this->cellDescription, activeSuperCells, BORDER )
+        (block)
+        ( this->getDeviceParticlesBox( ),
+          eBox,
+          bBox,
+          frameSolver
+          );
+
+    /* particles which stay in BORDER or move to CORE are shifted in finishUpdate(),
+     * else they would be pushed twice by the CORE push */
+    ParticlesBaseType::template shiftParticles < BORDER > ( true );
+
+    /* the exchange only touches GUARD and BORDER and runs during the CORE push */
+    tExchange.toggleStart( );
+    exchangeEvent = this->asyncCommunication( __getTransactionEvent( ), false );
+
+    __picKernelActiveArea( kernelMoveAndMarkParticles<BlockArea>, this->cellDescription, activeSuperCells, CORE )
         (block)
         ( this->getDeviceParticlesBox( ),
-          this->fieldE->getDeviceDataBox( ),
-          this->fieldB->getDeviceDataBox( ),
-          FrameSolver( )
+          eBox,
+          bBox,
+          frameSolver
           );
+}
 
+template<typename T_ParticleDescription>
+void Particles<T_ParticleDescription>::finishUpdate(uint32_t currentStep)
+{
+    if ( !isPushStep( currentStep ) )
+        return;
+
+    /* measure how long the exchange takes after the CORE push is finished,
+     * costs a synchronization and is only done if the log lvl is enabled */
+    if ( ggLog::log_level & ggLog::COMMUNICATION::lvl )
+    {
+        __getTransactionEvent( ).waitForFinished( );
+        TimeIntervall tExposed;
+        exchangeEvent.waitForFinished( );
+        tExposed.toggleEnd( );
+        tExchange.toggleEnd( );
+        log<ggLog::COMMUNICATION > ( "particle exchange %1% step %2%: %3% ms, %4% ms not hidden by the core push" ) %
+            FrameType::getName( ) % currentStep % tExchange.getInterval( ) % tExposed.getInterval( );
+    }
+
+    __setTransactionEvent( __getTransactionEvent( ) + exchangeEvent );
     ParticlesBaseType::template shiftParticles < CORE + BORDER > ( );
 }
 
+template<typename T_ParticleDescription>
+void Particles<T_ParticleDescription>::resample( uint32_t currentStep )
+{
+    typedef typename GetResampling<Particles>::type Resampling;
+
+    dim3 block( MappingDesc::SuperCellSize::toRT( ).toDim3() );
+
+    /* counting the particles needs two extra kernels and a synchronization,
+     * it is only done with the log lvl SIMULATION_STATE (off by default) */
+    const bool logResampling = picLog::log_level & picLog::SIMULATION_STATE::lvl;
+    const DataSpace<simDim> localSize( Environment<simDim>::get().SubGrid().getLocalDomain( ).size );
+    uint64_cu particlesBefore = 0;
+    TimeIntervall tResample;
+    if ( logResampling )
+    {
+        particlesBefore = PMacc::CountParticles::countOnDevice < CORE + BORDER > (
+            *this, this->cellDescription, DataSpace<simDim>( ), localSize );
+        tResample.toggleStart( );
+    }
+
+    if ( Resampling::maxParticles != 0 )
+    {
+        __picKernelArea( particles::resampling::kernelMergeParticles<Resampling>,
+                         this->cellDescription, CORE + BORDER )
+            (block)
+            ( this->getDeviceParticlesBox( ) );
+    }
+    if ( Resampling::minParticles != 0 )
+    {
+        __picKernelArea( particles::resampling::kernelSplitParticles<Resampling>,
+                         this->cellDescription, CORE + BORDER )
+            (block)
+            ( this->getDeviceParticlesBox( ) );
+    }
+    /* merged particles left gaps */
+    ParticlesBaseType::template fillGaps < CORE + BORDER > ( );
+
+    if ( logResampling )
+    {
+        __getTransactionEvent( ).waitForFinished( );
+        tResample.toggleEnd( );
+        const uint64_cu particlesAfter = PMacc::CountParticles::countOnDevice < CORE + BORDER > (
+            *this, this->cellDescription, DataSpace<simDim>( ), localSize );
+        log<picLog::SIMULATION_STATE > ( "resampling %1% step %2%: %3% -> %4% macro particles in %5% ms" ) %
+            FrameType::getName( ) % currentStep % particlesBefore % particlesAfter %
+            tResample.getInterval( );
+    }
+}
+
 template< typename T_ParticleDescription>
 void Particles<T_ParticleDescription>::reset( uint32_t )
 {
     this->particlesBuffer->reset( );
+    this->invalidateActiveSuperCells( );
+    if ( GetSubcycling<Particles>::value > 1 )
+    {
+        const float3_X zero( 0., 0., 0. );
+        averagedE->getDeviceBuffer( ).setValue( zero );
+        averagedB->getDeviceBuffer( ).setValue( zero );
+        heldCurrent->getDeviceBuffer( ).setValue( zero );
+    }
 }
 
 template< typename T_ParticleDescription>
 void Particles<T_ParticleDescription>::initFill( uint32_t currentStep )
 {
+    TimeIntervall initTime;
+
     Window window = MovingWindow::getInstance( ).getWindow( currentStep );
     const uint32_t numSlides = MovingWindow::getInstance().getSlideCounter( currentStep );
     const SubGrid<simDim>& subGrid = Environment<simDim>::get().SubGrid();
@@ -217,20 +394,105 @@ void Particles<T_ParticleDescription>::initFill( uint32_t currentStep )
             log<picLog::SIMULATION_STATE > ("Failed to setup gas profile");
         }
 
+#if (PARTICLE_INIT_EXACT_ALLOCATION == 1)
+        fillGridExact( gpuCellOffset, seed, currentStep, globalNrOfCells.y( ),
+                       dataBox.shift(this->fieldTmp->getGridLayout().getGuard()) );
+#else
         __picKernelArea( kernelFillGridWithParticles, this->cellDescription, CORE + BORDER + GUARD )
             (block)
             ( this->particlesBuffer->getDeviceParticleBox( ),
               this->particlesBuffer->hasSendExchange( TOP ),
               gpuCellOffset,
               seed,
+              currentStep,
               globalNrOfCells.y( ),
               dataBox.shift(this->fieldTmp->getGridLayout().getGuard()));
+#endif
     }
 
+#if (PARTICLE_INIT_EXACT_ALLOCATION != 1)
     this->fillAllGaps( );
+#endif
 
     log<picLog::SIMULATION_STATE > ( "Wait for init particles finished (y offset = %1%)" ) % gpuCellOffset.y( );
     __getTransactionEvent( ).waitForFinished( );
+
+    initTime.toggleEnd( );
+    log<picLog::SIMULATION_STATE > ( "init particles %1% took %2%" ) %
+        FrameType::getName( ) % initTime.printInterval( );
+}
+
+template< typename T_ParticleDescription>
+template< typename T_FieldBox>
+void Particles<T_ParticleDescription>::fillGridExact( DataSpace<simDim> gpuCellOffset,
+                                                      uint32_t seed,
+                                                      uint32_t currentStep,
+                                                      uint32_t gNrCellsY,
+                                                      T_FieldBox fieldBox )
+{
+    dim3 block( MappingDesc::SuperCellSize::toRT( ).toDim3() );
+    const uint32_t tileSize = PMacc::math::CT::volume<SuperCellSize>::type::value;
+
+    /* first pass: number of macro particles per supercell */
+    GridBuffer<vint_t, simDim> superCellCounter( this->cellDescription.getGridSuperCells( ) );
+
+    __picKernelArea( kernelCountMacroParticles, this->cellDescription, CORE + BORDER + GUARD )
+        (block)
+        ( superCellCounter.getDeviceBuffer( ).getDataBox( ),
+          gpuCellOffset,
+          gNrCellsY,
+          fieldBox );
+
+    superCellCounter.deviceToHost( );
+
+    /* exclusive prefix sum of the frames per supercell (in place),
+     * frames of neighboring supercells are neighbors on the heap */
+    const DataSpace<simDim> superCells( this->cellDescription.getGridSuperCells( ) );
+    PMACC_AUTO( counterBox, superCellCounter.getHostBuffer( ).getDataBox( ) );
+    vint_t numFrames = 0;
+    for ( uint32_t i = 0; i < (uint32_t) superCells.productOfComponents( ); ++i )
+    {
+        const DataSpace<simDim> superCellIdx( DataSpaceOperations<simDim>::map( superCells, i ) );
+        const vint_t numParticles = counterBox( superCellIdx );
+        counterBox( superCellIdx ) = numFrames;
+        numFrames += ( numParticles + tileSize - 1 ) / tileSize;
+    }
+    superCellCounter.hostToDevice( );
+
+    log<picLog::MEMORY > ( "init particles %1%: reserve %2% frames" ) %
+        FrameType::getName( ) % numFrames;
+
+    /* popN() does not check the ring, reserved frames must be free */
+    const size_t freeFrames = this->particlesBuffer->getFreeFrameCount( );
+    if ( numFrames > freeFrames )
+    {
+        std::stringstream msg;
+        msg << "init particles " << FrameType::getName( ) << ": " << numFrames <<
+            " frames needed but only " << freeFrames << " frames free, increase the particle memory";
+        throw std::runtime_error( msg.str( ) );
+    }
+
+    /* second pass: reserve all frames at once and fill them without gaps */
+    GridBuffer<vint_t, DIM1> firstFrame( DataSpace<DIM1>( 1 ) );
+    __cudaKernel( kernelReserveFrames )
+        (1, 1)
+        ( this->particlesBuffer->getDeviceParticleBox( ),
+          numFrames,
+          firstFrame.getDeviceBuffer( ).getBasePointer( ) );
+
+    __picKernelArea( kernelFillGridWithParticlesExact, this->cellDescription, CORE + BORDER + GUARD )
+        (block)
+        ( this->particlesBuffer->getDeviceParticleBox( ),
+          gpuCellOffset,
+          seed,
+          currentStep,
+          gNrCellsY,
+          fieldBox,
+          superCellCounter.getDeviceBuffer( ).getDataBox( ),
+          firstFrame.getDeviceBuffer( ).getBasePointer( ) );
+
+    /* the local buffers are freed at the end of this scope */
+    __getTransactionEvent( ).waitForFinished( );
 }
 
 template< typename T_ParticleDescription>
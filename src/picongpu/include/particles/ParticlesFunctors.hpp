@@ -26,6 +26,7 @@
 #include "traits/HasFlag.hpp"
 #include "fields/Fields.def"
 #include "math/MapTuple.hpp"
+#include "memory/MemoryAccounting.hpp"
 #include <boost/mpl/plus.hpp>
 #include <boost/mpl/accumulate.hpp>
 
@@ -68,6 +69,7 @@ struct CreateSpecies
     template<typename T_StorageTuple, typename T_CellDescription>
     HINLINE void operator()(T_StorageTuple& tuple, T_CellDescription* cellDesc) const
     {
+        MemoryOwner owner(SpeciesType::FrameType::getName());
         tuple[SpeciesName()] = new SpeciesType(cellDesc->getGridLayout(), *cellDesc, SpeciesType::FrameType::getName());
     }
 };
@@ -102,6 +104,7 @@ struct CallCreateParticleBuffer
             (byte / 1024 / 1024) %
             SpeciesType::FrameType::getName();
 
+        MemoryOwner owner(SpeciesType::FrameType::getName() + "/heap");
         tuple[SpeciesName()]->createParticleBuffer(byte);
     }
 };
@@ -160,8 +163,10 @@ struct CallUpdate
 
             __startTransaction(eventInt);
             speciesPtr->update(currentStep);
-            commEvent += speciesPtr->asyncCommunication(__getTransactionEvent());
-            updateEvent += __endTransaction();
+            /* fields can be changed after the push, while particles are exchanged */
+            updateEvent += __getTransactionEvent();
+            speciesPtr->finishUpdate(currentStep);
+            commEvent += __endTransaction();
         }
     }
 };
@@ -0,0 +1,92 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "simulation_defines.hpp"
+#include "particles/frame_types.hpp"
+#include "particles/memory/frames/NullFrame.hpp"
+#include "particles/traits/GetMass.hpp"
+
+namespace picongpu
+{
+namespace particles
+{
+namespace filter
+{
+using namespace PMacc;
+
+/** select particles by their kinetic energy
+ *
+ * The energy of one real particle (macro particle energy / weighting) is
+ * computed from the momentum and the mass of the species.
+ * The filter is disabled by default (all particles pass).
+ */
+template<class Base = NullFrame>
+class EnergyFilter : public Base
+{
+protected:
+    float_X minEnergy;
+    float_X maxEnergy;
+    bool energyActive;
+
+public:
+
+    HDINLINE EnergyFilter() : minEnergy(0.0), maxEnergy(0.0), energyActive(false)
+    {
+    }
+
+    /** set the energy range
+     *
+     * @param minEnergy lower limit (inclusive) in PIC units
+     * @param maxEnergy upper limit (exclusive) in PIC units, 0 means no upper limit
+     */
+    HDINLINE void setEnergyRange(float_X minEnergy, float_X maxEnergy)
+    {
+        this->minEnergy = minEnergy;
+        this->maxEnergy = maxEnergy;
+        energyActive = minEnergy > float_X(0.0) || maxEnergy > float_X(0.0);
+    }
+
+    template<class FRAME>
+    HDINLINE bool operator()(FRAME & frame, lcellId_t id)
+    {
+        bool result = true;
+        if (energyActive)
+        {
+            PMACC_AUTO(particle, frame[id]);
+            const float_X weighting = particle[weighting_];
+            const float3_X mom = particle[momentum_] / weighting;
+            const float_X mass = getMass<FRAME > (weighting) / weighting;
+            const float_X c2 = SPEED_OF_LIGHT * SPEED_OF_LIGHT;
+            const float_X mom2 = math::abs2(mom);
+            const float_X restEnergy = mass * c2;
+            /* sqrt(p^2 c^2 + m^2 c^4) - m c^2 without cancellation */
+            const float_X energy = c2 * mom2 / (math::sqrt(mom2 * c2 + restEnergy * restEnergy) + restEnergy);
+            result = energy >= minEnergy && (maxEnergy <= float_X(0.0) || energy < maxEnergy);
+        }
+        return result && Base::operator() (frame, id);
+    }
+};
+
+} //namespace filter
+} //namespace particles
+} //namespace picongpu
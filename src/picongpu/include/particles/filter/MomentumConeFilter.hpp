@@ -0,0 +1,82 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "simulation_defines.hpp"
+#include "particles/frame_types.hpp"
+#include "particles/memory/frames/NullFrame.hpp"
+
+namespace picongpu
+{
+namespace particles
+{
+namespace filter
+{
+using namespace PMacc;
+
+/** select particles with a momentum within a cone around a direction
+ *
+ * Particles without momentum are never within the cone.
+ * The filter is disabled by default (all particles pass).
+ */
+template<class Base = NullFrame>
+class MomentumConeFilter : public Base
+{
+protected:
+    float3_X coneDirection;
+    float_X cosHalfAngle;
+    bool coneActive;
+
+public:
+
+    HDINLINE MomentumConeFilter() : cosHalfAngle(-1.0), coneActive(false)
+    {
+    }
+
+    /** set the cone
+     *
+     * @param direction axis of the cone, gets normalized
+     * @param halfAngle half opening angle in rad, >= pi disables the filter
+     */
+    HDINLINE void setMomentumCone(float3_X direction, float_X halfAngle)
+    {
+        coneDirection = direction / math::abs(direction);
+        cosHalfAngle = math::cos(halfAngle);
+        coneActive = halfAngle < float_X(PI);
+    }
+
+    template<class FRAME>
+    HDINLINE bool operator()(FRAME & frame, lcellId_t id)
+    {
+        bool result = true;
+        if (coneActive)
+        {
+            const float3_X mom = frame[id][momentum_];
+            result = math::dot(mom, coneDirection) > cosHalfAngle * math::abs(mom);
+        }
+        return result && Base::operator() (frame, id);
+    }
+};
+
+} //namespace filter
+} //namespace particles
+} //namespace picongpu
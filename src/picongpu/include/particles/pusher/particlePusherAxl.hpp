@@ -66,12 +66,12 @@ namespace picongpu
                                                       PosType& pos, /* at t=0 */
                                                       MomType& mom, /* at t=-1/2 */
                                                       const MassType mass,
-                                                      const ChargeType charge)
+                                                      const ChargeType charge,
+                                                      const float_X deltaT)
             {
                 Gamma gammaCalc;
                 Velocity velocityCalc;
                 const float_X epsilon = 1.0e-6;
-                const float_X deltaT = DELTA_T;
 
                 //const float3_X velocity_atMinusHalf = velocity(mom, mass);
                 const float_X gamma = gammaCalc( mom, mass );
@@ -40,12 +40,11 @@ struct Push
                                             PosType& pos,
                                             MomType& mom,
                                             const MassType mass,
-                                            const ChargeType charge)
+                                            const ChargeType charge,
+                                            const float_X deltaT)
     {
         const float_X QoM = charge / mass;
 
-        const float_X deltaT = DELTA_T;
-
         const MomType mom_minus = mom + float_X(0.5) * charge * eField * deltaT;
 
         Gamma gamma;
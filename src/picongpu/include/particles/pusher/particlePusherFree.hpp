@@ -38,7 +38,8 @@ namespace picongpu
                                                         PosType& pos,
                                                         MomType& mom,
                                                         const MassType mass,
-                                                        const ChargeType charge)
+                                                        const ChargeType charge,
+                                                        const float_X deltaT)
             {
 
                 Velocity velocity;
@@ -47,7 +48,7 @@ namespace picongpu
 
                 for(uint32_t d=0;d<simDim;++d)
                 {
-                    pos[d] += (vel[d] * DELTA_T) / cellSize[d];
+                    pos[d] += (vel[d] * deltaT) / cellSize[d];
                 }
             }
         };
@@ -37,7 +37,8 @@ namespace picongpu
                                                         PosType& pos, /* at t=0 */
                                                         MomType& mom, /* at t=-1/2 */
                                                         const MassType mass,
-                                                        const ChargeType charge)
+                                                        const ChargeType charge,
+                                                        const float_X deltaT)
             {
             }
         };
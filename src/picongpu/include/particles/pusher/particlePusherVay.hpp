@@ -40,7 +40,8 @@ struct Push
                                             PosType& pos, /* at t=0 */
                                             MomType& mom, /* at t=-1/2 */
                                             const MassType mass,
-                                            const ChargeType charge)
+                                            const ChargeType charge,
+                                            const float_X deltaT)
     {
 
         /*
@@ -50,7 +51,6 @@ struct Push
      Here the real (PIConGPU) momentum (p) is used, not the momentum from the Vay paper (u)
      p = m_0 * u
          */
-        const float_X deltaT = DELTA_T;
         const float_X factor = 0.5 * charge * deltaT;
         Gamma gamma;
         Velocity velocity;
@@ -83,7 +83,7 @@ struct Push
 
         for(uint32_t d=0;d<simDim;++d)
         {
-            pos[d] += (vel[d] * DELTA_T) / cellSize[d];
+            pos[d] += (vel[d] * deltaT) / cellSize[d];
         }
     }
 };
@@ -0,0 +1,63 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "types.h"
+
+namespace picongpu
+{
+namespace particles
+{
+namespace resampling
+{
+
+/** thresholds of the macro particle resampling of a species
+ *
+ * Every T_period steps supercells with more than T_maxParticles macro
+ * particles are merged and supercells with less than T_minParticles are
+ * filled by splitting heavy particles. A value of zero disables the
+ * corresponding operation.
+ *
+ * @tparam T_period number of steps between two resamplings, 0 disables resampling
+ * @tparam T_minParticles lower limit of macro particles per supercell
+ * @tparam T_maxParticles upper limit of macro particles per supercell
+ * @tparam T_magnitudeBins number of momentum magnitude bins per octant,
+ *                         particles are only merged within one bin of
+ *                         one cell
+ */
+template<uint32_t T_period, uint32_t T_minParticles, uint32_t T_maxParticles, uint32_t T_magnitudeBins = 4>
+struct Thresholds
+{
+    static const uint32_t period = T_period;
+    static const uint32_t minParticles = T_minParticles;
+    static const uint32_t maxParticles = T_maxParticles;
+    static const uint32_t magnitudeBins = T_magnitudeBins;
+    /* 8 momentum octants times magnitude bins (per cell) */
+    static const uint32_t numBins = 8 * T_magnitudeBins;
+};
+
+/** no resampling */
+typedef Thresholds<0, 0, 0> None;
+
+} //namespace resampling
+} //namespace particles
+} //namespace picongpu
@@ -0,0 +1,53 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "simulation_defines.hpp"
+#include "traits/HasFlag.hpp"
+#include "traits/GetFlagType.hpp"
+#include "particles/resampling/Thresholds.hpp"
+
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/identity.hpp>
+
+namespace picongpu
+{
+
+/** resampling thresholds of a species
+ *
+ * @treturn ::type thresholds of the flag resampling<>,
+ *                 particles::resampling::None if the flag is not set
+ */
+template<typename T_Species>
+struct GetResampling
+{
+    typedef typename T_Species::FrameType FrameType;
+    typedef typename HasFlag<FrameType, resampling<> >::type HasResampling;
+
+    typedef typename bmpl::eval_if<
+        HasResampling,
+        GetFlagType<FrameType, resampling<> >,
+        bmpl::identity<particles::resampling::None>
+    >::type type;
+};
+
+}// namespace picongpu
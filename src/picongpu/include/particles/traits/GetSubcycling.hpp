@@ -0,0 +1,53 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "simulation_defines.hpp"
+#include "traits/HasFlag.hpp"
+#include "traits/GetFlagType.hpp"
+
+#include <boost/mpl/eval_if.hpp>
+#include <boost/mpl/identity.hpp>
+#include <boost/mpl/integral_c.hpp>
+
+namespace picongpu
+{
+
+/** number of steps between two pushes of a species
+ *
+ * @treturn ::value subcycling of the flag subcycling<>, 1 if the flag is not set
+ */
+template<typename T_Species>
+struct GetSubcycling
+{
+    typedef typename T_Species::FrameType FrameType;
+    typedef typename HasFlag<FrameType, subcycling<> >::type HasSubcycling;
+
+    typedef typename bmpl::eval_if<
+        HasSubcycling,
+        GetFlagType<FrameType, subcycling<> >,
+        bmpl::identity<bmpl::integral_c<uint32_t, 1> >
+    >::type type;
+
+    static const uint32_t value = type::value;
+};
+
+}// namespace picongpu
@@ -38,8 +38,7 @@
 #include "mappings/kernel/AreaMapping.hpp"
 #include "plugins/ISimulationPlugin.hpp"
 
-#include "mpi/reduceMethods/Reduce.hpp"
-#include "mpi/MPIReduce.hpp"
+#include "mpi/ReduceBatcher.hpp"
 #include "nvidia/functors/Add.hpp"
 
 #include "algorithms/Gamma.hpp"
@@ -199,7 +198,7 @@ __global__ void kernelBinEnergyParticles(ParticlesBox<FRAME, simDim> pb,
 }
 
 template<class ParticlesType>
-class BinEnergyParticles : public ISimulationPlugin
+class BinEnergyParticles : public ISimulationPlugin, public mpi::IReduceReceiver
 {
 private:
 
@@ -233,8 +232,6 @@ private:
     /* only rank 0 create a file */
     bool writeToFile;
 
-    mpi::MPIReduce reduce;
-
 public:
 
     BinEnergyParticles(std::string name, std::string prefix) :
@@ -343,7 +340,7 @@ private:
                 binReduced[i] = 0.0;
             }
 
-            writeToFile = reduce.hasResult(mpi::reduceMethods::Reduce());
+            writeToFile = Environment<>::get().ReduceBatcher().hasResult();
             if( writeToFile )
                 openNewFile();
 
@@ -438,7 +435,8 @@ private:
         const float_X minEnergy = minEnergy_keV * UNITCONV_keV_to_Joule / UNIT_ENERGY;
         const float_X maxEnergy = maxEnergy_keV * UNITCONV_keV_to_Joule / UNIT_ENERGY;
 
-        __picKernelArea(kernelBinEnergyParticles, *cellDescription, AREA)
+        __picKernelActiveArea(kernelBinEnergyParticles, *cellDescription,
+                              particles->getActiveSuperCells(), AREA)
             (block, (realNumBins) * sizeof (float_X))
             (particles->getDeviceParticlesBox(),
              gBins->getDeviceBuffer().getDataBox(), numBins, minEnergy,
@@ -446,11 +444,17 @@ private:
 
         gBins->deviceToHost();
 
-        reduce(nvidia::functors::Add(),
-               binReduced,
-               gBins->getHostBuffer().getBasePointer(),
-               realNumBins, mpi::reduceMethods::Reduce());
+        /* the histogram is written by reduceFinished() */
+        Environment<>::get().ReduceBatcher().enqueue(nvidia::functors::Add(),
+                                                     gBins->getHostBuffer().getBasePointer(),
+                                                     realNumBins,
+                                                     currentStep,
+                                                     this);
+    }
 
+    void reduceFinished(uint32_t currentStep, uint32_t, const void* result)
+    {
+        memcpy(binReduced, result, sizeof (double) * realNumBins);
 
         if (writeToFile)
         {
@@ -37,8 +37,7 @@
 
 #include "plugins/ILightweightPlugin.hpp"
 
-#include "mpi/reduceMethods/Reduce.hpp"
-#include "mpi/MPIReduce.hpp"
+#include "mpi/ReduceBatcher.hpp"
 #include "nvidia/functors/Add.hpp"
 #include "nvidia/functors/Max.hpp"
 
@@ -51,7 +50,7 @@ namespace picongpu
 using namespace PMacc;
 
 template<class ParticlesType>
-class CountParticles : public ILightweightPlugin
+class CountParticles : public ILightweightPlugin, public mpi::IReduceReceiver
 {
 private:
     typedef MappingDesc::SuperCellSize SuperCellSize;
@@ -69,7 +68,11 @@ private:
     /*only rank 0 create a file*/
     bool writeToFile;
 
-    mpi::MPIReduce reduce;
+    /* tags of the batched reductions */
+    enum
+    {
+        SUM = 0, MAXIMUM = 1
+    };
 public:
 
     CountParticles(std::string name, std::string prefix) :
@@ -121,7 +124,7 @@ private:
     {
         if (notifyFrequency > 0)
         {
-            writeToFile = reduce.hasResult(mpi::reduceMethods::Reduce());
+            writeToFile = Environment<>::get().ReduceBatcher().hasResult();
 
             if (writeToFile)
             {
@@ -167,32 +170,28 @@ private:
                                                           *cellDescription,
                                                           DataSpace<simDim>(),
                                                           localSize);
-        uint64_cu reducedValueMax;
+        /* the results are written by reduceFinished() */
+        mpi::ReduceBatcher& batcher = Environment<>::get().ReduceBatcher();
         if (picLog::log_level & picLog::CRITICAL::lvl)
-        {
-            reduce(nvidia::functors::Max(),
-                   &reducedValueMax,
-                   &size,
-                   1,
-                   mpi::reduceMethods::Reduce());
-        }
+            batcher.enqueue(nvidia::functors::Max(), &size, 1, currentStep, this, MAXIMUM);
 
+        batcher.enqueue(nvidia::functors::Add(), &size, 1, currentStep, this, SUM);
+    }
 
-        uint64_cu reducedValue;
-        reduce(nvidia::functors::Add(),
-               &reducedValue,
-               &size,
-               1,
-               mpi::reduceMethods::Reduce());
+    void reduceFinished(uint32_t currentStep, uint32_t tag, const void* result)
+    {
+        const uint64_cu reducedValue = *((const uint64_cu*) result);
 
         if (writeToFile)
         {
-            if (picLog::log_level & picLog::CRITICAL::lvl)
+            if (tag == MAXIMUM)
             {
-                log<picLog::CRITICAL > ("maximum number of  particles on a GPU : %d\n") % reducedValueMax;
+                log<picLog::CRITICAL > ("maximum number of  particles on a GPU : %d\n") % reducedValue;
+            }
+            else
+            {
+                outFile << currentStep << " " << reducedValue << " " << std::scientific << (double) reducedValue << std::endl;
             }
-
-            outFile << currentStep << " " << reducedValue << " " << std::scientific << (double) reducedValue << std::endl;
         }
     }
 
@@ -37,8 +37,7 @@
 #include "dimensions/DataSpaceOperations.hpp"
 #include "plugins/ILightweightPlugin.hpp"
 
-#include "mpi/reduceMethods/Reduce.hpp"
-#include "mpi/MPIReduce.hpp"
+#include "mpi/ReduceBatcher.hpp"
 #include "nvidia/functors/Add.hpp"
 #include "nvidia/reduce/Reduce.hpp"
 #include "memory/boxes/DataBoxDim1Access.hpp"
@@ -77,7 +76,7 @@ struct squareComponentWise
 
 }
 
-class EnergyFields : public ILightweightPlugin
+class EnergyFields : public ILightweightPlugin, public mpi::IReduceReceiver
 {
 private:
     FieldE* fieldE;
@@ -93,8 +92,6 @@ private:
     /*only rank 0 create a file*/
     bool writeToFile;
 
-    mpi::MPIReduce mpiReduce;
-
     nvidia::reduce::Reduce* localReduce;
 
     typedef typename promoteType<float_64, FieldB::ValueType>::type EneVectorType;
@@ -129,6 +126,13 @@ public:
         getEnergyFields(currentStep);
     }
 
+    bool getDataDependencies(uint32_t, DataDependencies& dependencies) const
+    {
+        dependencies.push_back(DataDependency(FieldE::getName(), DataDependency::DEVICE));
+        dependencies.push_back(DataDependency(FieldB::getName(), DataDependency::DEVICE));
+        return true;
+    }
+
     void pluginRegisterHelp(po::options_description& desc)
     {
         desc.add_options()
@@ -153,7 +157,7 @@ private:
         if (notifyFrequency > 0)
         {
             localReduce = new nvidia::reduce::Reduce(1024);
-            writeToFile = mpiReduce.hasResult(mpi::reduceMethods::Reduce());
+            writeToFile = Environment<>::get().ReduceBatcher().hasResult();
 
             if (writeToFile)
             {
@@ -191,19 +195,22 @@ private:
         /* idx == 0 -> fieldB
          * idx == 1 -> fieldE
          */
-        EneVectorType globalFieldEnergy[2];
-        globalFieldEnergy[0]=EneVectorType(0.0);
-        globalFieldEnergy[1]=EneVectorType(0.0);
-
         EneVectorType localReducedFieldEnergy[2];
         localReducedFieldEnergy[0] = reduceField(fieldB);
         localReducedFieldEnergy[1] = reduceField(fieldE);
 
-        mpiReduce(nvidia::functors::Add(),
-                  &globalFieldEnergy,
-                  &localReducedFieldEnergy,
-                  2,
-                  mpi::reduceMethods::Reduce());
+        /* the global sum is written by reduceFinished() */
+        Environment<>::get().ReduceBatcher().enqueue(nvidia::functors::Add(),
+                                                     localReducedFieldEnergy,
+                                                     2,
+                                                     currentStep,
+                                                     this);
+    }
+
+    void reduceFinished(uint32_t currentStep, uint32_t, const void* result)
+    {
+        EneVectorType globalFieldEnergy[2];
+        memcpy(globalFieldEnergy, result, sizeof (globalFieldEnergy));
 
         float_64 energyFieldBReduced=0.0;
         float_64 energyFieldEReduced=0.0;
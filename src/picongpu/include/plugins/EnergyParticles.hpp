@@ -36,8 +36,7 @@
 #include "mappings/kernel/AreaMapping.hpp"
 #include "plugins/ILightweightPlugin.hpp"
 
-#include "mpi/reduceMethods/Reduce.hpp"
-#include "mpi/MPIReduce.hpp"
+#include "mpi/ReduceBatcher.hpp"
 #include "nvidia/functors/Add.hpp"
 
 #include "algorithms/Gamma.hpp"
@@ -154,7 +153,7 @@ __global__ void kernelEnergyParticles(ParticlesBox<FRAME, simDim> pb,
 }
 
 template<class ParticlesType>
-class EnergyParticles : public ILightweightPlugin
+class EnergyParticles : public ILightweightPlugin, public mpi::IReduceReceiver
 {
 private:
     typedef MappingDesc::SuperCellSize SuperCellSize;
@@ -172,8 +171,6 @@ private:
     std::ofstream outFile; /* file output stream */
     bool writeToFile;   /* only rank 0 creates a file */
 
-    mpi::MPIReduce reduce; /* MPI reduce to add all energies over several GPUs */
-
 public:
 
     EnergyParticles(std::string name, std::string prefix) :
@@ -237,7 +234,7 @@ private:
         if (notifyFrequency > 0) /* only if plugin is called at least once */
         {
             /* decide which MPI-rank writes output: */
-            writeToFile = reduce.hasResult(mpi::reduceMethods::Reduce());
+            writeToFile = Environment<>::get().ReduceBatcher().hasResult();
 
             /* create two ints on gpu and host: */
             gEnergy = new GridBuffer<double, DIM1 > (DataSpace<DIM1 > (2));
@@ -292,21 +289,27 @@ private:
         dim3 block(MappingDesc::SuperCellSize::toRT().toDim3()); /* GPU parallelization */
 
         /* kernel call = sum all particle energies on GPU */
-        __picKernelArea(kernelEnergyParticles, *cellDescription, AREA)
+        __picKernelActiveArea(kernelEnergyParticles, *cellDescription,
+                              particles->getActiveSuperCells(), AREA)
             (block)
             (particles->getDeviceParticlesBox(),
              gEnergy->getDeviceBuffer().getDataBox());
 
         gEnergy->deviceToHost(); /* get energy from GPU */
 
-        double reducedEnergy[2]; /* create storage for kinetic and total energy */
+        /* add energies from all GPUs using MPI (batched with other plugins),
+         * the result is written in reduceFinished() */
+        Environment<>::get().ReduceBatcher().enqueue(nvidia::functors::Add(),
+                                                     gEnergy->getHostBuffer().getBasePointer(),
+                                                     2,
+                                                     currentStep,
+                                                     this);
+    }
 
-        /* add energies from all GPUs using MPI: */
-        reduce(nvidia::functors::Add(),
-               reducedEnergy,
-               gEnergy->getHostBuffer().getBasePointer(),
-               2,
-               mpi::reduceMethods::Reduce());
+    /** write the global kinetic and total energy **/
+    void reduceFinished(uint32_t currentStep, uint32_t, const void* result)
+    {
+        const double* reducedEnergy = (const double*) result;
 
         /* print timestep, kinetic energy and total energy to file: */
         if (writeToFile)
@@ -160,6 +160,12 @@ public:
         combineData(currentStep);
     }
 
+    bool getDataDependencies(uint32_t, DataDependencies& dependencies) const
+    {
+        dependencies.push_back(DataDependency(FieldE::getName(), DataDependency::DEVICE));
+        return true;
+    }
+
     void pluginRegisterHelp(po::options_description& desc)
     {
         desc.add_options()
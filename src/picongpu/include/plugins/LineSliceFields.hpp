@@ -124,6 +124,13 @@ namespace picongpu
 
         }
 
+        bool getDataDependencies(uint32_t, DataDependencies& dependencies) const
+        {
+            dependencies.push_back(DataDependency(FieldE::getName(), DataDependency::DEVICE));
+            dependencies.push_back(DataDependency(FieldB::getName(), DataDependency::DEVICE));
+            return true;
+        }
+
         void notify(uint32_t currentStep)
         {
             typedef typename MappingDesc::SuperCellSize SuperCellSize;
@@ -78,7 +78,12 @@ namespace picongpu
                     ((analyzerPrefix + ".ip").c_str(), po::value<std::vector<std::string > > (&ips)->multitoken(), "ip of server")
                     ((analyzerPrefix + ".port").c_str(), po::value<std::vector<std::string > > (&ports)->multitoken(), "port of server")
                     ((analyzerPrefix + ".axis").c_str(), po::value<std::vector<std::string > > (&axis)->multitoken(), "axis which are shown [valid values x,y,z] example: yz")
-                    ((analyzerPrefix + ".slicePoint").c_str(), po::value<std::vector<float> > (&slicePoints)->multitoken(), "value range: 0 <= x <= 1 , point of the slice");
+                    ((analyzerPrefix + ".slicePoint").c_str(), po::value<std::vector<float> > (&slicePoints)->multitoken(), "value range: 0 <= x <= 1 , point of the slice")
+                    ((analyzerPrefix + ".compression").c_str(), po::value<std::vector<int> > (&compressLevels)->multitoken(), "zlib compression level [0-9] (default: 1, fastest)")
+                    ((analyzerPrefix + ".encoding").c_str(), po::value<std::vector<std::string> > (&encodings)->multitoken(),
+                     "image encoding [zlib, frame (chunks compressed by several threads), raw (uncompressed)] (default: zlib)")
+                    ((analyzerPrefix + ".threads").c_str(), po::value<std::vector<uint32_t> > (&numThreads)->multitoken(),
+                     "threads which compress an image with encoding frame (default: 2)");
         }
 
         void setMappingDescription(MappingDesc *cellDescription)
@@ -107,7 +112,17 @@ namespace picongpu
 
                             if (getValue(axis, i).length() == 2u)
                             {
-                                LiveViewClient liveViewClient(getValue(ips, i), getValue(ports, i));
+                                int compressLevel = Z_BEST_SPEED;
+                                if (0 != compressLevels.size())
+                                    compressLevel = getValue(compressLevels, i);
+                                SocketConnector::Encoding encoding = SocketConnector::ENCODING_ZLIB;
+                                if (0 != encodings.size())
+                                    encoding = SocketConnector::getEncoding(getValue(encodings, i));
+                                uint32_t threads = 2;
+                                if (0 != numThreads.size())
+                                    threads = getValue(numThreads, i);
+                                LiveViewClient liveViewClient(getValue(ips, i), getValue(ports, i), compressLevel,
+                                                              encoding, threads);
                                 DataSpace<DIM2 > transpose(
                                                            charToAxisNumber(getValue(axis, i)[0]),
                                                            charToAxisNumber(getValue(axis, i)[1])
@@ -178,6 +193,9 @@ namespace picongpu
         std::vector<std::string> ips;
         std::vector<std::string> ports;
         std::vector<std::string> axis;
+        std::vector<int> compressLevels;
+        std::vector<std::string> encodings;
+        std::vector<uint32_t> numThreads;
         VisPointerList visIO;
 
         MappingDesc* cellDescription;
@@ -118,34 +118,9 @@ namespace picongpu
                 __delete( createReduce );
         }
 
-        /* Create communicator with ranks of each plane reduce root */
-        {
-            /* Array with root ranks of the planeReduce operations */
-            std::vector<int> planeReduceRootRanks( gc.getGlobalSize(), -1 );
-            /* Am I one of the planeReduce root ranks? my global rank : -1 */
-            int myRootRank = gc.getGlobalRank() * this->isPlaneReduceRoot
-                           - ( ! this->isPlaneReduceRoot );
-
-            MPI_Group world_group, new_group;
-            MPI_CHECK(MPI_Allgather( &myRootRank, 1, MPI_INT,
-                                     &(planeReduceRootRanks.front()),
-                                     1,
-                                     MPI_INT,
-                                     MPI_COMM_WORLD ));
-
-            /* remove all non-roots (-1 values) */
-            std::sort( planeReduceRootRanks.begin(), planeReduceRootRanks.end() );
-            std::vector<int> ranks( std::lower_bound( planeReduceRootRanks.begin(),
-                                                      planeReduceRootRanks.end(),
-                                                      0 ),
-                                    planeReduceRootRanks.end() );
-
-            MPI_CHECK(MPI_Comm_group( MPI_COMM_WORLD, &world_group ));
-            MPI_CHECK(MPI_Group_incl( world_group, ranks.size(), ranks.data(), &new_group ));
-            MPI_CHECK(MPI_Comm_create( MPI_COMM_WORLD, new_group, &commFileWriter ));
-            MPI_CHECK(MPI_Group_free( &new_group ));
-            MPI_CHECK(MPI_Group_free( &world_group ));
-        }
+        /* Communicator with ranks of each plane reduce root,
+         * ordered by global rank and shared via the registry */
+        commFileWriter = PMacc::Environment<simDim>::get().CommunicatorRegistry().getParticipants(this->isPlaneReduceRoot);
     }
 
     template<class AssignmentFunction, class Species>
@@ -154,8 +129,8 @@ namespace picongpu
         __delete( this->dBuffer );
         __delete( planeReduce );
 
-        if( commFileWriter != MPI_COMM_NULL )
-            MPI_CHECK(MPI_Comm_free( &commFileWriter ));
+        /* commFileWriter is owned by the CommunicatorRegistry */
+        commFileWriter = MPI_COMM_NULL;
     }
 
     template<class AssignmentFunction, class Species >
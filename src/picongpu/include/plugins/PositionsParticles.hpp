@@ -256,7 +256,8 @@ private:
         gParticle->getDeviceBuffer().setValue(positionParticleTmp);
         dim3 block(SuperCellSize::toRT().toDim3());
 
-        __picKernelArea(kernelPositionsParticles, *cellDescription, AREA)
+        __picKernelActiveArea(kernelPositionsParticles, *cellDescription,
+                              particles->getActiveSuperCells(), AREA)
             (block)
             (particles->getDeviceParticlesBox(),
              gParticle->getDeviceBuffer().getBasePointer());
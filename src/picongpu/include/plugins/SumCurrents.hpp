@@ -109,6 +109,12 @@ public:
 
     }
 
+    bool getDataDependencies(uint32_t, DataDependencies& dependencies) const
+    {
+        dependencies.push_back(DataDependency(FieldJ::getName(), DataDependency::DEVICE));
+        return true;
+    }
+
     void notify(uint32_t currentStep)
     {
         DataConnector &dc = Environment<>::get().DataConnector();
@@ -39,6 +39,7 @@
 #include <boost/type_traits.hpp>
 
 #include "plugins/output/WriteSpeciesCommon.hpp"
+#include "plugins/output/ParticleOutputFilter.hpp"
 #include "plugins/kernel/CopySpecies.kernel"
 #include "mappings/kernel/AreaMapping.hpp"
 
@@ -97,13 +98,16 @@ public:
         /* load particle without copy particle data to host */
         ThisSpecies* speciesTmp = &(dc.getData<ThisSpecies >(ThisSpecies::FrameType::getName(), true));
 
-        /* count total number of particles on the device */
+        /* count total number of particles on the device,
+         * same filter as used by WriteSpecies */
+        ParticleOutputFilter filter = createParticleOutputFilter(params->window,
+                                                                 params->localWindowToDomainOffset,
+                                                                 params->currentStep);
         uint64_cu totalNumParticles = 0;
         totalNumParticles = PMacc::CountParticles::countOnDevice < CORE + BORDER > (
                                                                                     *speciesTmp,
                                                                                     *(params->cellDescription),
-                                                                                    params->localWindowToDomainOffset,
-                                                                                    params->window.localDimensions.size);
+                                                                                    filter);
 
         /* MPI_Allgather to compute global size and my offset */
         uint64_t myNumParticles = totalNumParticles;
@@ -61,6 +61,7 @@
 
 #include <boost/type_traits.hpp>
 
+#include "plugins/output/AddHostDependency.hpp"
 #include "plugins/adios/WriteSpecies.hpp"
 #include "plugins/adios/ADIOSCountParticles.hpp"
 
@@ -427,6 +428,13 @@ public:
         this->cellDescription = cellDescription;
     }
 
+    bool getDataDependencies(uint32_t, DataDependencies& dependencies) const
+    {
+        ForEach<NativeFileOutputFields, AddHostDependency<bmpl::_1> > addHostDependency;
+        addHostDependency(forward(dependencies));
+        return true;
+    }
+
     __host__ void notify(uint32_t currentStep)
     {
         const SubGrid<simDim>& subGrid = Environment<simDim>::get().SubGrid();
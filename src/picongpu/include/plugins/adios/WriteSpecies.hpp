@@ -37,8 +37,10 @@
 #include <boost/type_traits.hpp>
 
 #include "plugins/output/WriteSpeciesCommon.hpp"
+#include "plugins/output/ParticleOutputFilter.hpp"
 #include "plugins/kernel/CopySpecies.kernel"
 #include "mappings/kernel/AreaMapping.hpp"
+#include "mappings/kernel/ActiveSuperCellMapping.hpp"
 
 #include "plugins/adios/writer/ParticleAttribute.hpp"
 #include "compileTime/conversion/RemoveFromSeq.hpp"
@@ -93,14 +95,17 @@ public:
         /* load particle without copy particle data to host */
         ThisSpecies* speciesTmp = &(dc.getData<ThisSpecies >(ThisSpecies::FrameType::getName(), true));
 
-        /* count total number of particles on the device */
+        /* count and copy with the same filter */
+        ParticleOutputFilter filter = createParticleOutputFilter(params->window,
+                                                                 params->localWindowToDomainOffset,
+                                                                 params->currentStep);
+
         log<picLog::INPUT_OUTPUT > ("ADIOS:  (begin) count particles: %1%") % AdiosFrameType::getName();
         uint64_cu totalNumParticles = 0;
         totalNumParticles = PMacc::CountParticles::countOnDevice < CORE + BORDER > (
                                                                                     *speciesTmp,
                                                                                     *(params->cellDescription),
-                                                                                    params->localWindowToDomainOffset,
-                                                                                    params->window.localDimensions.size);
+                                                                                    filter);
         log<picLog::INPUT_OUTPUT > ("ADIOS:  ( end ) count particles: %1% = %2%") % AdiosFrameType::getName() % totalNumParticles;
 
         if (totalNumParticles > 0)
@@ -121,27 +126,24 @@ public:
             log<picLog::INPUT_OUTPUT > ("ADIOS:  ( end ) get mapped memory device pointer: %1%") % AdiosFrameType::getName();
 
             log<picLog::INPUT_OUTPUT > ("ADIOS:  (begin) copy particle to host: %1%") % AdiosFrameType::getName();
-            typedef bmpl::vector< typename GetPositionFilter<simDim>::type > usedFilters;
-            typedef typename FilterFactory<usedFilters>::FilterType MyParticleFilter;
-            MyParticleFilter filter;
-            /* activeate filter pipeline if moving window is activated */
-            filter.setStatus(MovingWindow::getInstance().isSlidingWindowActive());
-            filter.setWindowPosition(params->localWindowToDomainOffset,
-                                     params->window.localDimensions.size);
-
             dim3 block(PMacc::math::CT::volume<SuperCellSize>::type::value);
 
             GridBuffer<int, DIM1> counterBuffer(DataSpace<DIM1>(1));
-            AreaMapping < CORE + BORDER, MappingDesc > mapper(*(params->cellDescription));
-
-            __cudaKernel(copySpecies)
-                (mapper.getGridDim(), block)
-                (counterBuffer.getDeviceBuffer().getPointer(),
-                 deviceFrame, speciesTmp->getDeviceParticlesBox(),
-                 filter,
-                 particleOffset, /*relative to data domain (not to physical domain)*/
-                 mapper
-                 );
+            /* only supercells with particles are visited */
+            ActiveSuperCellMapping < CORE + BORDER, MappingDesc > mapper(*(params->cellDescription),
+                                                                         speciesTmp->getActiveSuperCells());
+
+            for (bool launchKernel = !mapper.isEmpty(); launchKernel; launchKernel = mapper.next())
+            {
+                __cudaKernel(copySpecies)
+                    (mapper.getGridDim(), block)
+                    (counterBuffer.getDeviceBuffer().getPointer(),
+                     deviceFrame, speciesTmp->getDeviceParticlesBox(),
+                     filter,
+                     particleOffset, /*relative to data domain (not to physical domain)*/
+                     mapper
+                     );
+            }
             counterBuffer.deviceToHost();
             log<picLog::INPUT_OUTPUT > ("ADIOS:  ( end ) copy particle to host: %1%") % AdiosFrameType::getName();
             __getTransactionEvent().waitForFinished();
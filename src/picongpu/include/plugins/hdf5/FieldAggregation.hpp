@@ -0,0 +1,253 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+
+#pragma once
+
+#include <mpi.h>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include "types.h"
+#include "simulation_defines.hpp"
+#include "communication/manager_common.h"
+#include "mappings/simulation/GridController.hpp"
+#include "dimensions/DataSpace.hpp"
+#include "dimensions/DataSpaceOperations.hpp"
+
+namespace picongpu
+{
+
+namespace hdf5
+{
+using namespace PMacc;
+
+/** Aggregate field slabs of several ranks on one node to one aggregator rank
+ *
+ * Ranks are grouped if they are on the same node (MPI_COMM_TYPE_SHARED)
+ * and are neighbors in x direction of the device grid (same y and z position).
+ * Therefore the union of the local domains of a group is a box and the
+ * aggregator can write it with one large contiguous hyperslab.
+ * All other ranks of the group write an empty selection.
+ */
+class FieldAggregation
+{
+public:
+
+    FieldAggregation() :
+    groupComm(MPI_COMM_NULL),
+    groupSize(1),
+    groupRank(0)
+    {
+    }
+
+    virtual ~FieldAggregation()
+    {
+        finalize();
+    }
+
+    /** create the aggregation groups
+     *
+     * collective over all ranks of the device grid
+     *
+     * @param maxGroupSize maximal number of ranks handled by one aggregator
+     */
+    void init(uint32_t maxGroupSize)
+    {
+        finalize();
+
+        GridController<simDim>& gc = Environment<simDim>::get().GridController();
+        MPI_Comm gridComm = gc.getCommunicator().getMPIComm();
+        const DataSpace<simDim> gpuPos(gc.getPosition());
+        const DataSpace<simDim> gpuNodes(gc.getGpuNodes());
+
+        /* ranks on the same node */
+        MPI_Comm nodeComm;
+        MPI_CHECK(MPI_Comm_split_type(gridComm, MPI_COMM_TYPE_SHARED, gc.getGlobalRank(),
+                                      MPI_INFO_NULL, &nodeComm));
+
+        /* ranks on the same node with the same y and z position, sorted by x */
+        DataSpace<simDim> rowPos(gpuPos);
+        rowPos.x() = 0;
+        MPI_Comm rowComm;
+        MPI_CHECK(MPI_Comm_split(nodeComm,
+                                 DataSpaceOperations<simDim>::map(gpuNodes, rowPos),
+                                 gpuPos.x(),
+                                 &rowComm));
+        MPI_CHECK(MPI_Comm_free(&nodeComm));
+
+        int rowSize;
+        int rowRank;
+        MPI_CHECK(MPI_Comm_size(rowComm, &rowSize));
+        MPI_CHECK(MPI_Comm_rank(rowComm, &rowRank));
+
+        std::vector<int> rowX(rowSize);
+        int myX = gpuPos.x();
+        MPI_CHECK(MPI_Allgather(&myX, 1, MPI_INT, &(rowX[0]), 1, MPI_INT, rowComm));
+
+        /* split in runs of contiguous x positions with at most maxGroupSize ranks */
+        int groupId = 0;
+        uint32_t ranksInGroup = 0;
+        for (int i = 0; i < rowSize; ++i)
+        {
+            if (i != 0 && (rowX[i] != rowX[i - 1] + 1 || ranksInGroup == maxGroupSize))
+            {
+                ++groupId;
+                ranksInGroup = 0;
+            }
+            ++ranksInGroup;
+            if (i == rowRank)
+                break;
+        }
+
+        MPI_CHECK(MPI_Comm_split(rowComm, groupId, gpuPos.x(), &groupComm));
+        MPI_CHECK(MPI_Comm_free(&rowComm));
+
+        MPI_CHECK(MPI_Comm_size(groupComm, &groupSize));
+        MPI_CHECK(MPI_Comm_rank(groupComm, &groupRank));
+
+        int numAggregators = 0;
+        int isAggregatorFlag = isAggregator() ? 1 : 0;
+        MPI_CHECK(MPI_Allreduce(&isAggregatorFlag, &numAggregators, 1, MPI_INT, MPI_SUM, gridComm));
+        log<picLog::INPUT_OUTPUT > ("HDF5: %1% field aggregators for %2% ranks") %
+            numAggregators % gc.getGlobalSize();
+    }
+
+    void finalize()
+    {
+        if (groupComm != MPI_COMM_NULL)
+        {
+            MPI_CHECK(MPI_Comm_free(&groupComm));
+            groupComm = MPI_COMM_NULL;
+        }
+        groupSize = 1;
+        groupRank = 0;
+    }
+
+    /** true if more than one rank is in the aggregation group */
+    bool isActive() const
+    {
+        return groupSize > 1;
+    }
+
+    /** true if this rank writes the data of the group */
+    bool isAggregator() const
+    {
+        return groupRank == 0;
+    }
+
+    /** gather the local slabs of all group members on the aggregator
+     *
+     * collective over the group
+     *
+     * @param localData local slab, x is the fastest index
+     * @param localSize size of the local slab
+     * @param[out] groupData slab of the group (only filled on the aggregator)
+     * @param[out] groupDataSize size of the group slab (only set on the aggregator)
+     */
+    template<typename T_Type>
+    void gather(const T_Type* localData,
+                const DataSpace<simDim>& localSize,
+                std::vector<T_Type>& groupData,
+                DataSpace<simDim>& groupDataSize)
+    {
+        const int root = 0;
+        int localX = localSize.x();
+        int localElements = localSize.productOfComponents();
+
+        /* counts and displacements are given in elements of T_Type,
+         * with MPI_CHAR they overflow int above 2 GiB per group */
+        MPI_Datatype elementType;
+        MPI_CHECK(MPI_Type_contiguous(sizeof (T_Type), MPI_CHAR, &elementType));
+        MPI_CHECK(MPI_Type_commit(&elementType));
+
+        std::vector<int> sizeX(groupSize);
+        std::vector<int> elements(groupSize);
+        MPI_CHECK(MPI_Gather(&localX, 1, MPI_INT, &(sizeX[0]), 1, MPI_INT, root, groupComm));
+        MPI_CHECK(MPI_Gather(&localElements, 1, MPI_INT, &(elements[0]), 1, MPI_INT, root, groupComm));
+
+        std::vector<int> displs(groupSize, 0);
+        std::vector<int> offsetX(groupSize, 0);
+        int groupX = 0;
+        int isTooLarge = 0;
+        if (isAggregator())
+        {
+            uint64_t groupElements = 0;
+            for (int i = 0; i < groupSize; ++i)
+            {
+                offsetX[i] = groupX;
+                groupX += sizeX[i];
+                displs[i] = groupElements;
+                groupElements += elements[i];
+            }
+            /* the displacement of the last member must fit into int */
+            isTooLarge = groupElements - elements[groupSize - 1] > (uint64_t) std::numeric_limits<int>::max();
+            if (!isTooLarge)
+                staging.resize(groupElements * sizeof (T_Type));
+        }
+        MPI_CHECK(MPI_Bcast(&isTooLarge, 1, MPI_INT, root, groupComm));
+        if (isTooLarge)
+        {
+            MPI_CHECK(MPI_Type_free(&elementType));
+            throw std::runtime_error("HDF5 field aggregation: group is too large, reduce --hdf5.aggregation");
+        }
+
+        MPI_CHECK(MPI_Gatherv((void*) localData, localElements, elementType,
+                              staging.empty() ? NULL : &(staging[0]),
+                              &(elements[0]), &(displs[0]), elementType,
+                              root, groupComm));
+        MPI_CHECK(MPI_Type_free(&elementType));
+
+        if (!isAggregator())
+            return;
+
+        groupDataSize = localSize;
+        groupDataSize.x() = groupX;
+        groupData.resize(groupDataSize.productOfComponents());
+
+        /* all members have the same size in y and z, only the x rows are interleaved */
+        const size_t numRows = localSize.productOfComponents() / localSize.x();
+        const T_Type* src = (const T_Type*) &(staging[0]);
+        for (int i = 0; i < groupSize; ++i)
+        {
+            for (size_t row = 0; row < numRows; ++row)
+            {
+                std::copy(src, src + sizeX[i],
+                          &(groupData[row * groupX + offsetX[i]]));
+                src += sizeX[i];
+            }
+        }
+    }
+
+private:
+
+    MPI_Comm groupComm;
+    int groupSize;
+    int groupRank;
+
+    /* receive buffer on the aggregator in byte, reused for all fields */
+    std::vector<char> staging;
+};
+
+} //namespace hdf5
+} //namespace picongpu
@@ -51,6 +51,7 @@
 #include "pluginSystem/PluginConnector.hpp"
 #include "simulationControl/MovingWindow.hpp"
 #include "math/Vector.hpp"
+#include "simulationControl/TimeInterval.hpp"
 
 #include "plugins/ISimulationPlugin.hpp"
 #include <boost/mpl/vector.hpp>
@@ -63,6 +64,7 @@
 
 #include <boost/type_traits.hpp>
 
+#include "plugins/output/AddHostDependency.hpp"
 #include "plugins/hdf5/WriteFields.hpp"
 #include "plugins/hdf5/WriteSpecies.hpp"
 #include "plugins/hdf5/restart/LoadSpecies.hpp"
@@ -119,9 +121,17 @@ public:
              * and match ~30MiB with typical picongpu particles.
              * The only reason why we use 1M particles per chunk is that we can get a
              * frame overflow in our memory manager if we process all particles in one kernel.
+             * Two chunks are held in mapped host memory to read the next chunk
+             * while the current one is inserted.
              **/
             ("hdf5.restart-chunkSize", po::value<uint32_t > (&restartChunkSize)->default_value(1000000),
-             "Number of particles processed in one kernel call during restart to prevent frame count blowup");
+             "Number of particles processed in one kernel call during restart to prevent frame count blowup")
+            ("hdf5.particle-chunk", po::value<uint32_t > (&mThreadParams.particleChunkSize)->default_value(0),
+             "Number of particles copied to the host and written at once (bounds host memory), 0 = all particles at once")
+            ("hdf5.max-open-files", po::value<uint32_t > (&maxOpenFilesPerNode)->default_value(4),
+             "Maximal number of files opened at the same time per node")
+            ("hdf5.aggregation", po::value<uint32_t > (&aggregationSize)->default_value(1),
+             "Maximal number of ranks on one node which send their field data to one writing rank, 1 = disabled");
     }
 
     std::string pluginGetName() const
@@ -141,6 +151,19 @@ public:
         notificationReceived(currentStep, false);
     }
 
+    bool getDataDependencies(uint32_t currentStep, DataDependencies& dependencies) const
+    {
+        /* WriteFields copies the part of the fields inside the window only */
+        const Window window = MovingWindow::getInstance().getWindow(currentStep);
+        const Selection<simDim> windowRegion(window.localDimensions.size,
+                                             cellDescription->getGridLayout().getGuard() +
+                                             getLocalWindowToDomainOffset(window));
+
+        ForEach<NativeFileOutputFields, AddHostDependency<bmpl::_1> > addHostDependency;
+        addHostDependency(forward(dependencies), windowRegion);
+        return true;
+    }
+
     void checkpoint(uint32_t currentStep, const std::string checkpointDirectory)
     {
         this->checkpointDirectory = checkpointDirectory;
@@ -150,7 +173,6 @@ public:
 
     void restart(uint32_t restartStep, const std::string restartDirectory)
     {
-        const uint32_t maxOpenFilesPerNode = 4;
         GridController<simDim> &gc = Environment<simDim>::get().GridController();
         mThreadParams.dataCollector = new ParallelDomainCollector(
                                                                   gc.getCommunicator().getMPIComm(),
@@ -188,6 +210,25 @@ public:
         uint32_t slides = 0;
         mThreadParams.dataCollector->readAttribute(restartStep, NULL, "sim_slides", &slides);
 
+        /* the checkpoint can be written with another domain decomposition,
+         * a slide moves the window by the local domain size in y of the writing gpus
+         */
+        const uint32_t localSizeY = Environment<simDim>::get().SubGrid().getLocalDomain().size.y();
+        uint64_t slideCells = (uint64_t) slides * localSizeY;
+        try
+        {
+            mThreadParams.dataCollector->readAttribute(restartStep, NULL, "sim_slide_cells", &slideCells);
+        }
+        catch (DCException e)
+        {
+            log<picLog::INPUT_OUTPUT > ("HDF5: no attribute sim_slide_cells, assume same domain decomposition");
+        }
+        if (slideCells % localSizeY != 0)
+        {
+            throw std::runtime_error("HDF5 restart: moved window does not fit to the local domain size in y");
+        }
+        slides = slideCells / localSizeY;
+
         /* apply slides to set gpus to last/written configuration */
         log<picLog::INPUT_OUTPUT > ("Setting slide count for moving window to %1%") % slides;
         MovingWindow::getInstance().setSlideCounter(slides, restartStep);
@@ -202,13 +243,20 @@ public:
 
         ThreadParams *params = &mThreadParams;
 
-        /* load all fields */
+        /* load all fields, the upload of a field overlaps with reading the next one */
+        TimeIntervall restartTime;
         ForEach<FileCheckpointFields, LoadFields<bmpl::_1> > forEachLoadFields;
         forEachLoadFields(params);
+        __getTransactionEvent().waitForFinished();
+        restartTime.toggleEnd();
+        log<picLog::INPUT_OUTPUT > ("HDF5: restart fields took %1%") % restartTime.printInterval();
 
         /* load all particles */
+        restartTime.toggleStart();
         ForEach<FileCheckpointParticles, LoadSpecies<bmpl::_1> > forEachLoadSpecies;
         forEachLoadSpecies(params, restartChunkSize);
+        restartTime.toggleEnd();
+        log<picLog::INPUT_OUTPUT > ("HDF5: restart particles took %1%") % restartTime.printInterval();
 
         /* close datacollector */
         log<picLog::INPUT_OUTPUT > ("HDF5 close DataCollector with file: %1%") % restartFilename;
@@ -233,7 +281,6 @@ private:
 
     void openH5File(const std::string h5Filename)
     {
-        const uint32_t maxOpenFilesPerNode = 4;
         if (mThreadParams.dataCollector == NULL)
         {
             GridController<simDim> &gc = Environment<simDim>::get().GridController();
@@ -272,7 +319,6 @@ private:
      */
     void notificationReceived(uint32_t currentStep, bool isCheckpoint)
     {
-        const PMacc::Selection<simDim>& localDomain = Environment<simDim>::get().SubGrid().getLocalDomain();
         mThreadParams.isCheckpoint = isCheckpoint;
         mThreadParams.currentStep = currentStep;
         mThreadParams.cellDescription = this->cellDescription;
@@ -299,16 +345,7 @@ private:
             mThreadParams.window = MovingWindow::getInstance().getWindow(currentStep);
         }
 
-        for (uint32_t i = 0; i < simDim; ++i)
-        {
-            mThreadParams.localWindowToDomainOffset[i] = 0;
-            if (mThreadParams.window.globalDimensions.offset[i] > localDomain.offset[i])
-            {
-                mThreadParams.localWindowToDomainOffset[i] =
-                    mThreadParams.window.globalDimensions.offset[i] -
-                    localDomain.offset[i];
-            }
-        }
+        mThreadParams.localWindowToDomainOffset = getLocalWindowToDomainOffset(mThreadParams.window);
 
         openH5File(fname);
 
@@ -317,6 +354,21 @@ private:
         closeH5File();
     }
 
+    /** offset of the window in the local domain, 0 if the window starts on another gpu */
+    static DataSpace<simDim> getLocalWindowToDomainOffset(const Window& window)
+    {
+        const PMacc::Selection<simDim>& localDomain = Environment<simDim>::get().SubGrid().getLocalDomain();
+
+        DataSpace<simDim> offset;
+        for (uint32_t i = 0; i < simDim; ++i)
+        {
+            offset[i] = 0;
+            if (window.globalDimensions.offset[i] > localDomain.offset[i])
+                offset[i] = window.globalDimensions.offset[i] - localDomain.offset[i];
+        }
+        return offset;
+    }
+
     void pluginLoad()
     {
         GridController<simDim> &gc = Environment<simDim>::get().GridController();
@@ -324,6 +376,9 @@ private:
          * because we get problems with the restart.
          * Otherwise we do not know which gpu must load the ghost parts around
          * the sliding window.
+         * The restart itself reads fields by global hyperslabs and particles by
+         * the particles_info table, therefore a checkpoint can be loaded with
+         * another number of gpus (N-to-M restart).
          */
         mpi_pos = gc.getPosition();
         mpi_size = gc.getGpuNodes();
@@ -349,6 +404,12 @@ private:
             restartFilename = checkpointFilename;
         }
 
+        if (aggregationSize > 1)
+        {
+            fieldAggregation.init(aggregationSize);
+            mThreadParams.fieldAggregation = &fieldAggregation;
+        }
+
         loaded = true;
     }
 
@@ -358,6 +419,9 @@ private:
             mThreadParams.dataCollector->finalize();
 
         __delete(mThreadParams.dataCollector);
+
+        fieldAggregation.finalize();
+        mThreadParams.fieldAggregation = NULL;
     }
 
     typedef PICToSplash<float_X>::type SplashFloatXType;
@@ -377,6 +441,12 @@ private:
         dc->writeAttribute(threadParams->currentStep,
                            ctUInt32, NULL, "sim_slides", &slides);
 
+        /* number of cells the window moved, allows restarts with another domain decomposition */
+        const uint64_t slideCells = (uint64_t) slides *
+            Environment<simDim>::get().SubGrid().getLocalDomain().size.y();
+        dc->writeAttribute(threadParams->currentStep,
+                           ColTypeUInt64(), NULL, "sim_slide_cells", &slideCells);
+
         /* write normed grid parameters */
         dc->writeAttribute(currentStep, splashFloatXType, NULL, "delta_t", &DELTA_T);
         dc->writeAttribute(currentStep, splashFloatXType, NULL, "cell_width", &CELL_WIDTH);
@@ -414,6 +484,7 @@ private:
 
         /* write all fields */
         log<picLog::INPUT_OUTPUT > ("HDF5: (begin) writing fields.");
+        TimeIntervall fieldTime;
         if (threadParams->isCheckpoint)
         {
             ForEach<FileCheckpointFields, WriteFields<bmpl::_1> > forEachWriteFields;
@@ -424,7 +495,9 @@ private:
             ForEach<FileOutputFields, WriteFields<bmpl::_1> > forEachWriteFields;
             forEachWriteFields(threadParams);
         }
-        log<picLog::INPUT_OUTPUT > ("HDF5: ( end ) writing fields.");
+        fieldTime.toggleEnd();
+        log<picLog::INPUT_OUTPUT > ("HDF5: ( end ) writing fields, took %1%") %
+            fieldTime.printInterval();
 
         /* write all particle species */
         log<picLog::INPUT_OUTPUT > ("HDF5: (begin) writing particle species.");
@@ -455,6 +528,9 @@ private:
     std::string checkpointDirectory;
 
     uint32_t restartChunkSize;
+    uint32_t maxOpenFilesPerNode;
+    uint32_t aggregationSize;
+    FieldAggregation fieldAggregation;
 
     DataSpace<simDim> mpi_pos;
     DataSpace<simDim> mpi_size;
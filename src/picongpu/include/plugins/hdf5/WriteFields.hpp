@@ -76,7 +76,11 @@ public:
 #ifndef __CUDA_ARCH__
         DataConnector &dc = Environment<>::get().DataConnector();
 
-        T* field = &(dc.getData<T > (T::getName()));
+        /* only the part of the field inside the window is copied to the host */
+        GridLayout<simDim> layout = dc.getData<T > (T::getName(), true).getGridLayout();
+        Selection<simDim> windowRegion(params->window.localDimensions.size,
+                                       layout.getGuard() + params->localWindowToDomainOffset);
+        T* field = &(dc.getData<T > (T::getName(), windowRegion));
         params->gridLayout = field->getGridLayout();
 
         Field::writeField(params,
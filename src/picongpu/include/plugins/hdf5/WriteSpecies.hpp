@@ -40,12 +40,20 @@
 #include <boost/type_traits.hpp>
 
 #include "plugins/output/WriteSpeciesCommon.hpp"
+#include "plugins/output/ParticleOutputFilter.hpp"
 #include "plugins/kernel/CopySpecies.kernel"
 #include "mappings/kernel/AreaMapping.hpp"
+#include "mappings/kernel/ActiveSuperCellMapping.hpp"
 
 #include "plugins/hdf5/writer/ParticleAttribute.hpp"
+#include "particles/traits/GetSubcycling.hpp"
+#include "traits/PICToSplash.hpp"
 #include "compileTime/conversion/RemoveFromSeq.hpp"
 #include "particles/ParticleDescription.hpp"
+#include "communication/manager_common.h"
+
+#include <vector>
+#include <algorithm>
 
 namespace picongpu
 {
@@ -102,68 +110,83 @@ public:
         /* load particle without copy particle data to host */
         ThisSpecies* speciesTmp = &(dc.getData<ThisSpecies >(ThisSpecies::FrameType::getName(), true));
 
-        /* count total number of particles on the device */
-        uint64_cu totalNumParticles = 0;
-
-        log<picLog::INPUT_OUTPUT > ("HDF5:  (begin) count particles: %1%") % Hdf5FrameType::getName();
-        totalNumParticles = PMacc::CountParticles::countOnDevice < CORE + BORDER > (
-                                                                                    *speciesTmp,
-                                                                                    *(params->cellDescription),
-                                                                                    params->localWindowToDomainOffset,
-                                                                                    params->window.localDimensions.size);
-
+        const std::string speciesGroup(std::string("particles/") + FrameType::getName() +
+                                       std::string("/") + subGroup);
 
-        log<picLog::INPUT_OUTPUT > ("HDF5:  ( end ) count particles: %1% = %2%") % Hdf5FrameType::getName() % totalNumParticles;
-        Hdf5FrameType hostFrame;
-        log<picLog::INPUT_OUTPUT > ("HDF5:  (begin) malloc mapped memory: %1%") % Hdf5FrameType::getName();
-        /*malloc mapped memory*/
-        ForEach<typename Hdf5FrameType::ValueTypeSeq, MallocMemory<bmpl::_1> > mallocMem;
-        mallocMem(forward(hostFrame), totalNumParticles);
-        log<picLog::INPUT_OUTPUT > ("HDF5:  ( end ) malloc mapped memory: %1%") % Hdf5FrameType::getName();
+        /* total number of particles on the device */
+        uint64_cu totalNumParticles = 0;
 
-        if (totalNumParticles != 0)
+        if (params->particleChunkSize != 0)
         {
-
-            log<picLog::INPUT_OUTPUT > ("HDF5:  (begin) get mapped memory device pointer: %1%") % Hdf5FrameType::getName();
-            /*load device pointer of mapped memory*/
-            Hdf5FrameType deviceFrame;
-            ForEach<typename Hdf5FrameType::ValueTypeSeq, GetDevicePtr<bmpl::_1> > getDevicePtr;
-            getDevicePtr(forward(deviceFrame), forward(hostFrame));
-            log<picLog::INPUT_OUTPUT > ("HDF5:  ( end ) get mapped memory device pointer: %1%") % Hdf5FrameType::getName();
-
-            log<picLog::INPUT_OUTPUT > ("HDF5:  (begin) copy particle to host: %1%") % Hdf5FrameType::getName();
-            typedef bmpl::vector< typename GetPositionFilter<simDim>::type > usedFilters;
-            typedef typename FilterFactory<usedFilters>::FilterType MyParticleFilter;
-            MyParticleFilter filter;
-            /* activate filter pipeline if moving window is activated */
-            filter.setStatus(MovingWindow::getInstance().isSlidingWindowActive());
-            filter.setWindowPosition(params->localWindowToDomainOffset,
-                                     params->window.localDimensions.size);
-
-            dim3 block(PMacc::math::CT::volume<SuperCellSize>::type::value);
-
-            GridBuffer<int, DIM1> counterBuffer(DataSpace<DIM1>(1));
-            AreaMapping < CORE + BORDER, MappingDesc > mapper(*(params->cellDescription));
-
-            __cudaKernel(copySpecies)
-                (mapper.getGridDim(), block)
-                (counterBuffer.getDeviceBuffer().getPointer(),
-                 deviceFrame, speciesTmp->getDeviceParticlesBox(),
-                 filter,
-                 particleOffset, /*relative to data domain (not to physical domain)*/
-                 mapper
-                 );
-            counterBuffer.deviceToHost();
-            log<picLog::INPUT_OUTPUT > ("HDF5:  ( end ) copy particle to host: %1%") % Hdf5FrameType::getName();
-            __getTransactionEvent().waitForFinished();
-            log<picLog::INPUT_OUTPUT > ("HDF5:  all events are finished: %1%") % Hdf5FrameType::getName();
-            /*this cost a little bit of time but hdf5 writing is slower^^*/
-            assert((uint64_cu) counterBuffer.getHostBuffer().getDataBox()[0] == totalNumParticles);
+            totalNumParticles = writeChunked(params, speciesTmp, speciesGroup, particleOffset);
+        }
+        else
+        {
+            /* count and copy with the same filter, checkpoints contain all particles */
+            ParticleOutputFilter filter = createParticleOutputFilter(params->window,
+                                                                     params->localWindowToDomainOffset,
+                                                                     params->currentStep,
+                                                                     !params->isCheckpoint);
+
+            log<picLog::INPUT_OUTPUT > ("HDF5:  (begin) count particles: %1%") % Hdf5FrameType::getName();
+            totalNumParticles = PMacc::CountParticles::countOnDevice < CORE + BORDER > (
+                                                                                        *speciesTmp,
+                                                                                        *(params->cellDescription),
+                                                                                        filter);
+
+
+            log<picLog::INPUT_OUTPUT > ("HDF5:  ( end ) count particles: %1% = %2%") % Hdf5FrameType::getName() % totalNumParticles;
+            Hdf5FrameType hostFrame;
+            log<picLog::INPUT_OUTPUT > ("HDF5:  (begin) malloc mapped memory: %1%") % Hdf5FrameType::getName();
+            /*malloc mapped memory*/
+            ForEach<typename Hdf5FrameType::ValueTypeSeq, MallocMemory<bmpl::_1> > mallocMem;
+            mallocMem(forward(hostFrame), totalNumParticles);
+            log<picLog::INPUT_OUTPUT > ("HDF5:  ( end ) malloc mapped memory: %1%") % Hdf5FrameType::getName();
+
+            if (totalNumParticles != 0)
+            {
+
+                log<picLog::INPUT_OUTPUT > ("HDF5:  (begin) get mapped memory device pointer: %1%") % Hdf5FrameType::getName();
+                /*load device pointer of mapped memory*/
+                Hdf5FrameType deviceFrame;
+                ForEach<typename Hdf5FrameType::ValueTypeSeq, GetDevicePtr<bmpl::_1> > getDevicePtr;
+                getDevicePtr(forward(deviceFrame), forward(hostFrame));
+                log<picLog::INPUT_OUTPUT > ("HDF5:  ( end ) get mapped memory device pointer: %1%") % Hdf5FrameType::getName();
+
+                log<picLog::INPUT_OUTPUT > ("HDF5:  (begin) copy particle to host: %1%") % Hdf5FrameType::getName();
+                dim3 block(PMacc::math::CT::volume<SuperCellSize>::type::value);
+
+                GridBuffer<int, DIM1> counterBuffer(DataSpace<DIM1>(1));
+                /* only supercells with particles are visited */
+                ActiveSuperCellMapping < CORE + BORDER, MappingDesc > mapper(*(params->cellDescription),
+                                                                             speciesTmp->getActiveSuperCells());
+
+                for (bool launchKernel = !mapper.isEmpty(); launchKernel; launchKernel = mapper.next())
+                {
+                    __cudaKernel(copySpecies)
+                        (mapper.getGridDim(), block)
+                        (counterBuffer.getDeviceBuffer().getPointer(),
+                         deviceFrame, speciesTmp->getDeviceParticlesBox(),
+                         filter,
+                         particleOffset, /*relative to data domain (not to physical domain)*/
+                         mapper
+                         );
+                }
+                counterBuffer.deviceToHost();
+                log<picLog::INPUT_OUTPUT > ("HDF5:  ( end ) copy particle to host: %1%") % Hdf5FrameType::getName();
+                __getTransactionEvent().waitForFinished();
+                log<picLog::INPUT_OUTPUT > ("HDF5:  all events are finished: %1%") % Hdf5FrameType::getName();
+                /*this cost a little bit of time but hdf5 writing is slower^^*/
+                assert((uint64_cu) counterBuffer.getHostBuffer().getDataBox()[0] == totalNumParticles);
+            }
+            /*dump to hdf5 file*/
+            ForEach<typename Hdf5FrameType::ValueTypeSeq, hdf5::ParticleAttribute<bmpl::_1> > writeToHdf5;
+            writeToHdf5(params, forward(hostFrame), speciesGroup, totalNumParticles);
+
+            /*free host memory*/
+            ForEach<typename Hdf5FrameType::ValueTypeSeq, FreeMemory<bmpl::_1> > freeMem;
+            freeMem(forward(hostFrame));
         }
-        /*dump to hdf5 file*/
-        ForEach<typename Hdf5FrameType::ValueTypeSeq, hdf5::ParticleAttribute<bmpl::_1> > writeToHdf5;
-        writeToHdf5(params, forward(hostFrame), std::string("particles/") + FrameType::getName() + std::string("/") + subGroup,
-                totalNumParticles);
 
         /* write meta attributes for species */
         writeMetaAttributes(params);
@@ -176,17 +199,14 @@ public:
 
             const size_t pos_offset = 2;
 
-            /* particlesMetaInfo = (num particles, scalar position, particle offset x, y, z) */
+            /* particlesMetaInfo = (num particles, scalar position, local domain offset x, y, z)
+             * the offset is the absolute offset of the local domain (not relative to the window),
+             * the restart uses it to find the writers overlapping a local domain
+             */
+            const PMacc::Selection<simDim>& localDomain = Environment<simDim>::get().SubGrid().getLocalDomain();
             uint64_t particlesMetaInfo[5] = {totalNumParticles, gc.getScalarPosition(), 0, 0, 0};
             for (size_t d = 0; d < simDim; ++d)
-                particlesMetaInfo[pos_offset + d] = particleOffset[d];
-
-            /* prevent that top (y) gpus have negative value here */
-            if (gc.getPosition().y() == 0)
-                particlesMetaInfo[pos_offset + 1] = 0;
-
-            if (particleOffset[1] < 0) // 1 == y
-                particlesMetaInfo[pos_offset + 1] = 0;
+                particlesMetaInfo[pos_offset + d] = localDomain.offset[d];
 
             params->dataCollector->write(
                 params->currentStep,
@@ -194,20 +214,197 @@ public:
                 Dimensions(gc.getGlobalRank(), 0, 0),
                 ctUInt64_5, 1,
                 Dimensions(1, 1, 1),
-                (std::string("particles/") + FrameType::getName() + std::string("/") +
-                    subGroup + std::string("/particles_info")).c_str(),
+                (speciesGroup + std::string("/particles_info")).c_str(),
                 particlesMetaInfo);
         }
         log<picLog::INPUT_OUTPUT > ("HDF5:  ( end ) writing particle index table for %1%") % Hdf5FrameType::getName();
 
-        /*free host memory*/
-        ForEach<typename Hdf5FrameType::ValueTypeSeq, FreeMemory<bmpl::_1> > freeMem;
-        freeMem(forward(hostFrame));
+        /* a subcycled species can not continue without the fields and the current of its cycle */
+        if (params->isCheckpoint && GetSubcycling<ThisSpecies>::value > 1)
+        {
+            writeLocalBuffer(params, speciesTmp->getAveragedE(), speciesGroup + std::string("/subcycling_averagedE"));
+            writeLocalBuffer(params, speciesTmp->getAveragedB(), speciesGroup + std::string("/subcycling_averagedB"));
+            writeLocalBuffer(params, speciesTmp->getHeldCurrent(), speciesGroup + std::string("/subcycling_heldCurrent"));
+        }
+
         log<picLog::INPUT_OUTPUT > ("HDF5: ( end ) writing species: %1%") % Hdf5FrameType::getName();
     }
 
 private:
 
+    /** write a buffer of the local domain including its guards
+     *
+     * The dataset holds the buffers of all processes in the order of the
+     * ranks (like particles_info), it can only be loaded with the domain
+     * decomposition of the checkpoint.
+     */
+    static void writeLocalBuffer(ThreadParams* params,
+                                 GridBuffer<float3_X, simDim>& buffer,
+                                 const std::string name)
+    {
+        typedef PICToSplash<float_X>::type SplashType;
+        GridController<simDim>& gc = Environment<simDim>::get().GridController();
+
+        buffer.deviceToHost();
+        __getTransactionEvent().waitForFinished();
+
+        const size_t numComponents = buffer.getGridLayout().getDataSpace().productOfComponents() * float3_X::dim;
+        SplashType splashType;
+        params->dataCollector->write(
+            params->currentStep,
+            Dimensions(gc.getGlobalSize() * numComponents, 1, 1),
+            Dimensions(gc.getGlobalRank() * numComponents, 0, 0),
+            splashType, 1,
+            Dimensions(numComponents, 1, 1),
+            name.c_str(),
+            (float_X*) buffer.getHostBuffer().getDataBox().getPointer());
+    }
+
+    /** copy and write particles in chunks of at most particleChunkSize particles
+     *
+     * Particles are counted per supercell first, the chunks are built from
+     * ranges of supercells. The copy of chunk n+1 to mapped host memory
+     * runs while chunk n is written (double buffering).
+     * Host memory is bounded by two chunks (a chunk contains at least one
+     * full supercell).
+     *
+     * @param params thread parameters
+     * @param speciesTmp species to write
+     * @param speciesGroup hdf5 group of the species
+     * @param particleOffset offset of the local domain to the window origin
+     * @return number of written particles of this rank
+     */
+    template<typename Space>
+    static uint64_cu writeChunked(ThreadParams* params,
+                                  ThisSpecies* speciesTmp,
+                                  const std::string& speciesGroup,
+                                  const Space particleOffset)
+    {
+        /* count and copy with the same filter, checkpoints contain all particles */
+        ParticleOutputFilter filter = createParticleOutputFilter(params->window,
+                                                                 params->localWindowToDomainOffset,
+                                                                 params->currentStep,
+                                                                 !params->isCheckpoint);
+
+        dim3 block(PMacc::math::CT::volume<SuperCellSize>::type::value);
+        /* only supercells with particles are visited */
+        const ActiveSuperCellList activeSuperCells(speciesTmp->getActiveSuperCells());
+        ActiveSuperCellMapping < CORE + BORDER, MappingDesc > mapper(*(params->cellDescription),
+                                                                     activeSuperCells);
+
+        log<picLog::INPUT_OUTPUT > ("HDF5:  (begin) count particles per supercell: %1%") % Hdf5FrameType::getName();
+        const DataSpace<simDim> superCells(params->cellDescription->getGridSuperCells());
+        GridBuffer<uint32_t, simDim> superCellCounter(superCells);
+        superCellCounter.getDeviceBuffer().setValue(0);
+
+        for (bool launchKernel = !mapper.isEmpty(); launchKernel; launchKernel = mapper.next())
+        {
+            __cudaKernel(countSpeciesPerSuperCell)
+                (mapper.getGridDim(), block)
+                (superCellCounter.getDeviceBuffer().getDataBox(),
+                 speciesTmp->getDeviceParticlesBox(),
+                 filter,
+                 mapper);
+        }
+        superCellCounter.deviceToHost();
+
+        /* split the supercells in chunks: chunkBegin[i] is the first supercell of chunk i */
+        PMACC_AUTO(counterBox, superCellCounter.getHostBuffer().getDataBox());
+        const uint32_t numSuperCells = superCells.productOfComponents();
+        std::vector<uint32_t> chunkBegin;
+        std::vector<uint64_cu> chunkSize;
+        uint64_cu totalNumParticles = 0;
+        uint64_cu maxChunkSize = 0;
+        for (uint32_t i = 0; i < numSuperCells; ++i)
+        {
+            const uint32_t count = counterBox(DataSpaceOperations<simDim>::map(superCells, i));
+            if (count == 0)
+                continue;
+            if (chunkSize.empty() || chunkSize.back() + count > params->particleChunkSize)
+            {
+                chunkBegin.push_back(i);
+                chunkSize.push_back(0);
+            }
+            chunkSize.back() += count;
+            maxChunkSize = std::max(maxChunkSize, chunkSize.back());
+            totalNumParticles += count;
+        }
+        chunkBegin.push_back(numSuperCells);
+
+        uint32_t numChunks = chunkSize.size();
+        uint32_t globalNumChunks = 0;
+        GridController<simDim>& gc = Environment<simDim>::get().GridController();
+        /* append is collective, all ranks need the same number of calls */
+        MPI_CHECK(MPI_Allreduce(&numChunks, &globalNumChunks, 1, MPI_UNSIGNED, MPI_MAX,
+                                gc.getCommunicator().getMPIComm()));
+        log<picLog::INPUT_OUTPUT > ("HDF5:  ( end ) count particles per supercell: %1% = %2% in %3% chunks") %
+            Hdf5FrameType::getName() % totalNumParticles % numChunks;
+
+        /* reserve all datasets */
+        size_t globalOffset = 0;
+        ForEach<typename Hdf5FrameType::ValueTypeSeq, hdf5::ReserveParticleAttribute<bmpl::_1> > reserveInHdf5;
+        reserveInHdf5(params, speciesGroup, (size_t) totalNumParticles, forward(globalOffset));
+
+        /* two mapped host buffers for double buffering */
+        Hdf5FrameType hostFrame[2];
+        Hdf5FrameType deviceFrame[2];
+        ForEach<typename Hdf5FrameType::ValueTypeSeq, MallocMemory<bmpl::_1> > mallocMem;
+        ForEach<typename Hdf5FrameType::ValueTypeSeq, GetDevicePtr<bmpl::_1> > getDevicePtr;
+        for (int b = 0; b < 2; ++b)
+        {
+            mallocMem(forward(hostFrame[b]), maxChunkSize);
+            getDevicePtr(forward(deviceFrame[b]), forward(hostFrame[b]));
+        }
+
+        GridBuffer<int, DIM1> counterBuffer(DataSpace<DIM1>(1));
+        std::vector<char> tmpBuffer;
+        ForEach<typename Hdf5FrameType::ValueTypeSeq, hdf5::AppendParticleAttribute<bmpl::_1> > appendToHdf5;
+
+        EventTask copyEvent = __getTransactionEvent();
+        for (uint32_t c = 0; c <= globalNumChunks; ++c)
+        {
+            /* start copy of chunk c */
+            if (c < numChunks)
+            {
+                counterBuffer.getDeviceBuffer().setValue(0);
+                ActiveSuperCellMapping < CORE + BORDER, MappingDesc > chunkMapper(*(params->cellDescription),
+                                                                                  activeSuperCells);
+                for (bool launchKernel = !chunkMapper.isEmpty(); launchKernel; launchKernel = chunkMapper.next())
+                {
+                    __cudaKernel(copySpeciesRange)
+                        (chunkMapper.getGridDim(), block)
+                        (counterBuffer.getDeviceBuffer().getPointer(),
+                         deviceFrame[c % 2], speciesTmp->getDeviceParticlesBox(),
+                         filter,
+                         particleOffset, /*relative to data domain (not to physical domain)*/
+                         chunkBegin[c], chunkBegin[c + 1],
+                         chunkMapper
+                         );
+                }
+                copyEvent = __getTransactionEvent();
+            }
+
+            /* write chunk c-1 while chunk c is copied */
+            if (c > 0)
+            {
+                const uint32_t w = c - 1;
+                const size_t elements = w < numChunks ? chunkSize[w] : 0;
+                appendToHdf5(params, forward(hostFrame[w % 2]), speciesGroup,
+                             elements, globalOffset, forward(tmpBuffer));
+                globalOffset += elements;
+            }
+
+            copyEvent.waitForFinished();
+        }
+
+        /*free host memory*/
+        ForEach<typename Hdf5FrameType::ValueTypeSeq, FreeMemory<bmpl::_1> > freeMem;
+        for (int b = 0; b < 2; ++b)
+            freeMem(forward(hostFrame[b]));
+
+        return totalNumParticles;
+    }
+
     /**
      * Writes additional meta-attributes directly to species group
      *
@@ -45,6 +45,16 @@
 #include "plugins/output/WriteSpeciesCommon.hpp"
 #include "plugins/kernel/CopySpeciesGlobal2Local.kernel"
 #include "plugins/hdf5/restart/LoadParticleAttributesFromHDF5.hpp"
+#include "particles/traits/GetSubcycling.hpp"
+#include "communication/manager_common.h"
+#include "eventSystem/EventSystem.hpp"
+#include "simulationControl/TimeInterval.hpp"
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
 
 namespace picongpu
 {
@@ -105,113 +115,306 @@ public:
         /* load particle without copying particle data to host */
         ThisSpecies* speciesTmp = &(dc.getData<ThisSpecies >(ThisSpecies::FrameType::getName(), true));
 
-        /* count total number of particles on the device */
-        uint64_cu totalNumParticles = 0;
-
-        /* load particles info table entry for this process
+        /* load particles info table of all processes which wrote the checkpoint
            particlesInfo is (part-count, scalar pos, x, y, z) */
-        typedef uint64_t uint64Quint[5];
-        uint64Quint particlesInfo[gc.getGlobalSize()];
+        const std::string particlesInfoName = subGroup + std::string("/particles_info");
         Dimensions particlesInfoSizeRead;
-
         params->dataCollector->read(params->currentStep,
-                                    (std::string(subGroup) + std::string("/particles_info")).c_str(),
+                                    particlesInfoName.c_str(),
                                     particlesInfoSizeRead,
-                                    particlesInfo);
+                                    NULL);
 
-        assert(particlesInfoSizeRead[0] == gc.getGlobalSize());
+        const size_t numWriters = particlesInfoSizeRead[0];
+        std::vector<uint64_t> particlesInfo(numWriters * particlesInfoEntries);
+        params->dataCollector->read(params->currentStep,
+                                    particlesInfoName.c_str(),
+                                    particlesInfoSizeRead,
+                                    &(particlesInfo[0]));
 
-        /* search my entry (using my scalar position) in particlesInfo */
-        uint64_t particleOffset = 0;
-        uint64_t myScalarPos = gc.getScalarPosition();
+        /* ranges (offset, size) in the particle datasets which can hold particles of the local domain */
+        std::vector<std::pair<uint64_t, uint64_t> > readRanges;
+        uint64_t totalNumParticlesFile = 0;
+        size_t sameDomainWriter = numWriters;
+        getReadRanges(particlesInfo, numWriters, readRanges, totalNumParticlesFile, sameDomainWriter);
 
-        for (size_t i = 0; i < particlesInfoSizeRead[0]; ++i)
+        uint64_t maxRangeSize = 0;
+        uint64_t numParticlesToRead = 0;
+        for (size_t i = 0; i < readRanges.size(); ++i)
         {
-            if (particlesInfo[i][1] == myScalarPos)
-            {
-                totalNumParticles = particlesInfo[i][0];
-                break;
-            }
-
-            particleOffset += particlesInfo[i][0];
+            maxRangeSize = std::max(maxRangeSize, readRanges[i].second);
+            numParticlesToRead += readRanges[i].second;
         }
 
-        log<picLog::INPUT_OUTPUT > ("Loading %1% particles from offset %2%") %
-            (long long unsigned) totalNumParticles % (long long unsigned) particleOffset;
+        log<picLog::INPUT_OUTPUT > ("Loading %1% particles from %2% ranges of %3% written domains") %
+            (long long unsigned) numParticlesToRead % readRanges.size() % numWriters;
 
-        if (totalNumParticles != 0)
+        /* counter is used to count loaded particles and used frames
+         * [0] -> number of loaded particles
+         * [1] -> number of used frames
+         *
+         * all values are zero after initialization
+         */
+        GridBuffer<uint32_t, DIM1> counterBuffer(DataSpace<DIM1>(2));
+        uint64_t numLoadedParticles = 0;
+
+        if (maxRangeSize != 0)
         {
+            /* split all ranges in chunks of at most restartChunkSize particles
+             * (offset in file, number of particles) */
+            std::vector<std::pair<uint64_t, uint64_t> > chunks;
+            for (size_t r = 0; r < readRanges.size(); ++r)
+            {
+                for (uint64_t c = 0; c < readRanges[r].second; c += restartChunkSize)
+                {
+                    const uint64_t chunkSize = std::min(readRanges[r].second - c, (uint64_t) restartChunkSize);
+                    chunks.push_back(std::make_pair(readRanges[r].first + c, chunkSize));
+                }
+            }
+            const uint64_t bufferSize = std::min(maxRangeSize, (uint64_t) restartChunkSize);
 
-            Hdf5FrameType hostFrame;
-            log<picLog::INPUT_OUTPUT > ("HDF5:  malloc mapped memory: %1%") % Hdf5FrameType::getName();
-            /*malloc mapped memory*/
-            ForEach<typename Hdf5FrameType::ValueTypeSeq, MallocMemory<bmpl::_1> > mallocMem;
-            mallocMem(forward(hostFrame), totalNumParticles);
-
-            log<picLog::INPUT_OUTPUT > ("HDF5:  get mapped memory device pointer: %1%") % Hdf5FrameType::getName();
-            /*load device pointer of mapped memory*/
-            Hdf5FrameType deviceFrame;
-            ForEach<typename Hdf5FrameType::ValueTypeSeq, GetDevicePtr<bmpl::_1> > getDevicePtr;
-            getDevicePtr(forward(deviceFrame), forward(hostFrame));
-
-            ForEach<typename Hdf5FrameType::ValueTypeSeq, LoadParticleAttributesFromHDF5<bmpl::_1> > loadAttributes;
-            loadAttributes(forward(params), forward(hostFrame), subGroup, particleOffset, totalNumParticles);
-
-            dim3 block(PMacc::math::CT::volume<SuperCellSize>::type::value);
-
-            /* counter is used to apply for work, count used frames and count loaded particles
-             * [0] -> offset for loading particles
-             * [1] -> number of loaded particles
-             * [2] -> number of used frames
-             *
-             * all values are zero after initialization
+            /* two mapped host frames: chunk n+1 is read from the file
+             * while chunk n is inserted on the device
              */
-            GridBuffer<uint32_t, DIM1> counterBuffer(DataSpace<DIM1>(3));
+            Hdf5FrameType hostFrame[2];
+            Hdf5FrameType deviceFrame[2];
+            EventTask bufferEvent[2];
+            log<picLog::INPUT_OUTPUT > ("HDF5:  malloc mapped memory: %1%") % Hdf5FrameType::getName();
+            for (uint32_t b = 0; b < 2; ++b)
+            {
+                /*malloc mapped memory*/
+                ForEach<typename Hdf5FrameType::ValueTypeSeq, MallocMemory<bmpl::_1> > mallocMem;
+                mallocMem(forward(hostFrame[b]), bufferSize);
+
+                /*load device pointer of mapped memory*/
+                ForEach<typename Hdf5FrameType::ValueTypeSeq, GetDevicePtr<bmpl::_1> > getDevicePtr;
+                getDevicePtr(forward(deviceFrame[b]), forward(hostFrame[b]));
+                bufferEvent[b] = __getTransactionEvent();
+            }
 
             const uint32_t cellsInSuperCell = PMacc::math::CT::volume<SuperCellSize>::type::value;
+            double readTime = 0.0;
+            double waitTime = 0.0;
+            TimeIntervall loadTime;
 
-            const uint32_t iterationsForLoad = ceil(double(totalNumParticles) / double(restartChunkSize));
-            uint32_t leftOverParticles = totalNumParticles;
-
-            __startAtomicTransaction(__getTransactionEvent());
-
-            for (uint32_t i = 0; i < iterationsForLoad; ++i)
+            for (size_t i = 0; i < chunks.size(); ++i)
             {
-                /* only load a chunk of particles per iteration to avoid blow up of frame usage
+                const uint32_t b = i % 2;
+                const uint32_t currentChunkSize = chunks[i].second;
+
+                /* the buffer is free if the insertion of chunk i-2 is finished */
+                TimeIntervall waitInterval;
+                bufferEvent[b].waitForFinished();
+                waitInterval.toggleEnd();
+                waitTime += waitInterval.getInterval();
+
+                TimeIntervall readInterval;
+                ForEach<typename Hdf5FrameType::ValueTypeSeq, LoadParticleAttributesFromHDF5<bmpl::_1> > loadAttributes;
+                loadAttributes(forward(params), forward(hostFrame[b]), subGroup, chunks[i].first, currentChunkSize);
+                readInterval.toggleEnd();
+                readTime += readInterval.getInterval();
+
+                log<picLog::INPUT_OUTPUT > ("HDF5:   load particles on device chunk offset=%1%; chunk size=%2%; chunk %3% of %4%") %
+                    chunks[i].first % currentChunkSize % (i + 1) % chunks.size();
+
+                /* only load a chunk of particles per kernel call to avoid blow up of frame usage,
+                 * the kernel runs asynchronous to the read of the next chunk
                  */
-                uint32_t currentChunkSize = std::min(leftOverParticles, restartChunkSize);
-                log<picLog::INPUT_OUTPUT > ("HDF5:   load particles on device chunk offset=%1%; chunk size=%2%; left particles %3%") %
-                    (i * restartChunkSize) % currentChunkSize % leftOverParticles;
+                const uint32_t numBlocks = ceil(double(currentChunkSize) / double(cellsInSuperCell));
+                __startAtomicTransaction(__getTransactionEvent());
                 __cudaKernel(copySpeciesGlobal2Local)
-                    (ceil(double(currentChunkSize) / double(cellsInSuperCell)), cellsInSuperCell)
+                    (numBlocks, cellsInSuperCell)
                     (counterBuffer.getDeviceBuffer().getDataBox(),
-                     speciesTmp->getDeviceParticlesBox(), deviceFrame,
-                     (int) totalNumParticles,
+                     speciesTmp->getDeviceParticlesBox(), deviceFrame[b],
+                     (int) currentChunkSize,
                      localDomain.offset, /*relative to data domain (not to physical domain)*/
+                     localDomain.size,
                      *(params->cellDescription)
                      );
                 speciesTmp->fillAllGaps();
-                leftOverParticles -= currentChunkSize;
+                bufferEvent[b] = __endTransaction();
+                __setTransactionEvent(bufferEvent[b]);
             }
-            __setTransactionEvent(__endTransaction());
+
             counterBuffer.deviceToHost();
             log<picLog::INPUT_OUTPUT > ("HDF5:  wait for last processed chunk: %1%") % Hdf5FrameType::getName();
             __getTransactionEvent().waitForFinished();
+            loadTime.toggleEnd();
+
+            numLoadedParticles = counterBuffer.getHostBuffer().getDataBox()[0];
+            log<picLog::INPUT_OUTPUT > ("HDF5: used frames to load particles: %1%") %
+                counterBuffer.getHostBuffer().getDataBox()[1];
+
+            size_t bytesPerParticle = 0;
+            ForEach<typename Hdf5FrameType::ValueTypeSeq, AddAttributeSize<bmpl::_1> > addAttributeSize;
+            addAttributeSize(forward(bytesPerParticle));
+
+            const double loadSeconds = std::max(loadTime.getInterval(), 1.0) / 1000.0;
+            const double readSeconds = std::max(readTime, 1.0) / 1000.0;
+            log<picLog::INPUT_OUTPUT > ("HDF5: restart species %1%: %2% particles in %3% (%4% particles/s), "
+                                        "read %5% (%6% MiB/s), waited for device %7%") %
+                Hdf5FrameType::getName() % numParticlesToRead % loadTime.printInterval() %
+                (uint64_t) (double(numParticlesToRead) / loadSeconds) %
+                TimeIntervall::printeTime(readTime) %
+                (uint64_t) (double(numParticlesToRead * bytesPerParticle) /
+                            readSeconds / (1024.0 * 1024.0)) %
+                TimeIntervall::printeTime(waitTime);
+
+            /*free host memory*/
+            for (uint32_t b = 0; b < 2; ++b)
+            {
+                ForEach<typename Hdf5FrameType::ValueTypeSeq, FreeMemory<bmpl::_1> > freeMem;
+                freeMem(forward(hostFrame[b]));
+            }
+        }
 
-            log<picLog::INPUT_OUTPUT > ("HDF5: used frames to load particles: %1%") % counterBuffer.getHostBuffer().getDataBox()[2];
+        /* every particle of the file must be loaded by exactly one process */
+        uint64_t numLoadedParticlesGlobal = 0;
+        MPI_CHECK(MPI_Allreduce(&numLoadedParticles, &numLoadedParticlesGlobal, 1, MPI_UINT64_T, MPI_SUM,
+                                gc.getCommunicator().getMPIComm()));
+        if (numLoadedParticlesGlobal != totalNumParticlesFile)
+        {
+            std::stringstream msg;
+            msg << "HDF5 restart: loaded " << numLoadedParticlesGlobal << " particles of species " <<
+                Hdf5FrameType::getName() << " but the checkpoint contains " << totalNumParticlesFile;
+            throw std::runtime_error(msg.str());
+        }
+
+        if (GetSubcycling<ThisSpecies>::value > 1)
+        {
+            /* the buffers include the guards of the local domain */
+            int isSameDomain = sameDomainWriter < numWriters;
+            int isSameDomainGlobal = 0;
+            MPI_CHECK(MPI_Allreduce(&isSameDomain, &isSameDomainGlobal, 1, MPI_INT, MPI_MIN,
+                                    gc.getCommunicator().getMPIComm()));
+            if (!isSameDomainGlobal)
+                throw std::runtime_error(std::string("HDF5 restart: subcycled species ") + Hdf5FrameType::getName() +
+                                         " can only be restarted with the domain decomposition of the checkpoint");
+
+            loadLocalBuffer(params, speciesTmp->getAveragedE(), subGroup + std::string("/subcycling_averagedE"),
+                            sameDomainWriter);
+            loadLocalBuffer(params, speciesTmp->getAveragedB(), subGroup + std::string("/subcycling_averagedB"),
+                            sameDomainWriter);
+            loadLocalBuffer(params, speciesTmp->getHeldCurrent(), subGroup + std::string("/subcycling_heldCurrent"),
+                            sameDomainWriter);
+        }
+
+        log<picLog::INPUT_OUTPUT > ("HDF5: ( end ) load species: %1%") % Hdf5FrameType::getName();
+    }
 
-            if ((uint64_cu) counterBuffer.getHostBuffer().getDataBox()[1] != totalNumParticles)
+private:
+
+    /* entries per process in particles_info: (part-count, scalar pos, absolute local domain offset x, y, z) */
+    static const size_t particlesInfoEntries = 5;
+    static const size_t particlesInfoPosOffset = 2;
+
+    /** select the parts of the particle datasets which must be read by this process
+     *
+     * If the checkpoint was written with the current domain decomposition
+     * only the own entry of particles_info is used.
+     * Otherwise the domains of the writing processes are reconstructed from the
+     * offsets in particles_info (the borders of all domains are the sorted distinct offsets)
+     * and all domains overlapping the local domain are read. Particles outside
+     * of the local domain are dropped by copySpeciesGlobal2Local.
+     *
+     * @param particlesInfo particles_info table of the checkpoint
+     * @param numWriters number of processes which wrote the checkpoint
+     * @param[out] readRanges ranges (offset, size) of particles to read
+     * @param[out] totalNumParticles number of particles in the checkpoint
+     * @param[out] sameDomainWriter process which wrote the local domain,
+     *                              numWriters if the decomposition differs
+     */
+    static void getReadRanges(const std::vector<uint64_t>& particlesInfo,
+                              const size_t numWriters,
+                              std::vector<std::pair<uint64_t, uint64_t> >& readRanges,
+                              uint64_t& totalNumParticles,
+                              size_t& sameDomainWriter)
+    {
+        GridController<simDim> &gc = Environment<simDim>::get().GridController();
+        const PMacc::Selection<simDim>& localDomain = Environment<simDim>::get().SubGrid().getLocalDomain();
+        const DataSpace<simDim> globalSize = Environment<simDim>::get().SubGrid().getGlobalDomain().size;
+
+        totalNumParticles = 0;
+        std::vector<uint64_t> writerOffsets(numWriters, 0);
+        for (size_t w = 0; w < numWriters; ++w)
+        {
+            writerOffsets[w] = totalNumParticles;
+            totalNumParticles += particlesInfo[w * particlesInfoEntries];
+        }
+
+        readRanges.clear();
+        sameDomainWriter = numWriters;
+
+        /* same decomposition: read own entry (found by scalar position) */
+        if (numWriters == gc.getGlobalSize())
+        {
+            for (size_t w = 0; w < numWriters; ++w)
             {
-                log<picLog::INPUT_OUTPUT >("HDF5:  error load species | counter is %1% but should %2%") % counterBuffer.getHostBuffer().getDataBox()[1] % totalNumParticles;
+                const uint64_t* info = &(particlesInfo[w * particlesInfoEntries]);
+                bool sameDomain = (info[1] == gc.getScalarPosition());
+                for (uint32_t d = 0; d < simDim; ++d)
+                    sameDomain = sameDomain && (info[particlesInfoPosOffset + d] == (uint64_t) localDomain.offset[d]);
+                if (sameDomain)
+                {
+                    sameDomainWriter = w;
+                    readRanges.push_back(std::make_pair(writerOffsets[w], info[0]));
+                    return;
+                }
             }
-            assert((uint64_cu) counterBuffer.getHostBuffer().getDataBox()[1] == totalNumParticles);
+        }
 
-            /*free host memory*/
-            ForEach<typename Hdf5FrameType::ValueTypeSeq, FreeMemory<bmpl::_1> > freeMem;
-            freeMem(forward(hostFrame));
-            log<picLog::INPUT_OUTPUT > ("HDF5: ( end ) load species: %1%") % Hdf5FrameType::getName();
+        log<picLog::INPUT_OUTPUT > ("HDF5: checkpoint was written with another domain decomposition (%1% processes)") %
+            numWriters;
+
+        /* borders of the written domains per dimension */
+        std::vector<uint64_t> borders[simDim];
+        for (uint32_t d = 0; d < simDim; ++d)
+        {
+            for (size_t w = 0; w < numWriters; ++w)
+                borders[d].push_back(particlesInfo[w * particlesInfoEntries + particlesInfoPosOffset + d]);
+            borders[d].push_back(globalSize[d]);
+            std::sort(borders[d].begin(), borders[d].end());
+            borders[d].erase(std::unique(borders[d].begin(), borders[d].end()), borders[d].end());
+        }
+
+        for (size_t w = 0; w < numWriters; ++w)
+        {
+            const uint64_t* info = &(particlesInfo[w * particlesInfoEntries]);
+            bool overlaps = true;
+            for (uint32_t d = 0; d < simDim; ++d)
+            {
+                const uint64_t begin = info[particlesInfoPosOffset + d];
+                const uint64_t end = *std::upper_bound(borders[d].begin(), borders[d].end(), begin);
+                const uint64_t localBegin = localDomain.offset[d];
+                const uint64_t localEnd = localBegin + localDomain.size[d];
+                overlaps = overlaps && (begin < localEnd) && (localBegin < end);
+            }
+            if (overlaps && info[0] != 0)
+                readRanges.push_back(std::make_pair(writerOffsets[w], info[0]));
         }
     }
+
+    /** load a buffer of the local domain including its guards
+     *
+     * @param writer process which wrote the local domain (\see WriteSpecies::writeLocalBuffer)
+     */
+    static void loadLocalBuffer(ThreadParams* params,
+                                GridBuffer<float3_X, simDim>& buffer,
+                                const std::string name,
+                                const size_t writer)
+    {
+        const size_t numComponents = buffer.getGridLayout().getDataSpace().productOfComponents() * float3_X::dim;
+        Dimensions sizeRead(0, 0, 0);
+        params->dataCollector->read(params->currentStep,
+                                    Dimensions(numComponents, 1, 1),
+                                    Dimensions(writer * numComponents, 0, 0),
+                                    name.c_str(),
+                                    sizeRead,
+                                    (float_X*) buffer.getHostBuffer().getDataBox().getPointer());
+        if (sizeRead[0] != numComponents)
+            throw std::runtime_error(std::string("HDF5 restart: size of ") + name + " does not fit to the local domain");
+
+        buffer.hostToDevice();
+    }
 };
 
 
@@ -33,6 +33,9 @@
 #include "fields/FieldE.hpp"
 #include "fields/FieldB.hpp"
 #include "simulationControl/MovingWindow.hpp"
+#include "simulationControl/TimeInterval.hpp"
+
+#include <algorithm>
 
 namespace picongpu
 {
@@ -50,6 +53,7 @@ public:
     static void loadField(Data& field, std::string objectName, ThreadParams *params)
     {
         log<picLog::INPUT_OUTPUT > ("Begin loading field '%1%'") % objectName;
+        TimeIntervall readTime;
         const DataSpace<simDim> field_guard = field.getGridLayout().getGuard();
 
         const uint32_t numSlides = MovingWindow::getInstance().getSlideCounter(params->currentStep);
@@ -107,13 +111,19 @@ public:
             delete field_container;
         }
 
+        /* the copy to the device runs asynchronous to the read of the next field,
+         * the caller must wait for the transaction event before the field is used
+         */
         field.hostToDevice();
 
-        __getTransactionEvent().waitForFinished();
-
+        readTime.toggleEnd();
+        const double bytes = double(params->window.localDimensions.size.productOfComponents()) *
+            simDim * sizeof (float_X);
         log<picLog::INPUT_OUTPUT > ("Read from domain: offset=%1% size=%2%") %
             domain_offset.toString() % local_domain_size.toString();
-        log<picLog::INPUT_OUTPUT > ("Finished loading field '%1%'") % objectName;
+        log<picLog::INPUT_OUTPUT > ("Finished loading field '%1%' in %2% (%3% MiB/s)") %
+            objectName % readTime.printInterval() %
+            (uint64_t) (bytes / (std::max(readTime.getInterval(), 1.0) / 1000.0) / (1024.0 * 1024.0));
     }
 
     template<class Data>
@@ -26,6 +26,7 @@
 #include "traits/PICToSplash.hpp"
 #include "traits/GetComponentsType.hpp"
 #include "traits/GetNComponents.hpp"
+#include <vector>
 
 namespace picongpu
 {
@@ -95,6 +96,8 @@ struct Field
 
         size_t tmpArraySize = field_no_guard.productOfComponents();
         ComponentType* tmpArray = new ComponentType[tmpArraySize];
+        /* slab of the aggregation group (only used on aggregators) */
+        std::vector<ComponentType> groupArray;
 
         typedef DataBoxDim1Access<NativeDataBoxType > D1Box;
         D1Box d1Access(dataBox.shift(field_guard), field_no_guard);
@@ -121,6 +124,24 @@ struct Field
                 sizeSrcData[i] = field_no_guard[i];
             }
 
+            ComponentType* writeArray = tmpArray;
+            if (params->fieldAggregation != NULL && params->fieldAggregation->isActive())
+            {
+                /* the aggregator writes the slabs of all ranks of its group,
+                 * all other ranks take part in the collective write with an empty selection
+                 */
+                DataSpace<simDim> groupSize;
+                params->fieldAggregation->gather(tmpArray, field_no_guard, groupArray, groupSize);
+                if (params->fieldAggregation->isAggregator())
+                {
+                    for (uint32_t i = 0; i < simDim; ++i)
+                        sizeSrcData[i] = groupSize[i];
+                    writeArray = &(groupArray[0]);
+                }
+                else
+                    sizeSrcData[0] = 0;
+            }
+
             params->dataCollector->writeDomain(params->currentStep,             /* id == time step */
                                                splashGlobalDomainSize,          /* total size of dataset over all processes */
                                                splashGlobalOffsetFile,          /* write offset for this process */
@@ -133,7 +154,7 @@ struct Field
                                                       splashGlobalDomainSize    /* size of the global domain */
                                                ),
                                                DomainCollector::GridType,
-                                               tmpArray);
+                                               writeArray);
 
             /*simulation attributes for data*/
             ColTypeDouble ctDouble;
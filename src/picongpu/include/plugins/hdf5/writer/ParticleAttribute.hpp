@@ -23,6 +23,9 @@
 #pragma once
 
 
+#include <vector>
+#include <sstream>
+
 #include "types.h"
 #include "simulation_types.hpp"
 #include "plugins/hdf5/HDF5Writer.def"
@@ -41,6 +44,43 @@ using namespace PMacc;
 using namespace splash;
 
 
+/** get the local and global splash domain of the particle output
+ *
+ * @param threadParams wrapped params with window and current step
+ * @param[out] splashLocalDomain domain of the local gpu
+ * @param[out] splashGlobalDomain domain of the global moving window
+ */
+HINLINE void getParticleDomains(const ThreadParams* threadParams,
+                                splash::Domain& splashLocalDomain,
+                                splash::Domain& splashGlobalDomain)
+{
+    /* globalSlideOffset due to gpu slides between origin at time step 0
+     * and origin at current time step
+     * ATTENTION: splash offset are globalSlideOffset + picongpu offsets
+     */
+    DataSpace<simDim> globalSlideOffset;
+    const PMacc::Selection<simDim>& localDomain = Environment<simDim>::get().SubGrid().getLocalDomain();
+    const uint32_t numSlides = MovingWindow::getInstance().getSlideCounter(threadParams->currentStep);
+    globalSlideOffset.y() += numSlides * localDomain.size.y();
+
+    Dimensions splashDomainOffset(0, 0, 0);
+    Dimensions splashGlobalDomainOffset(0, 0, 0);
+
+    Dimensions splashDomainSize(1, 1, 1);
+    Dimensions splashGlobalDomainSize(1, 1, 1);
+
+    for (uint32_t d = 0; d < simDim; ++d)
+    {
+        splashDomainOffset[d] = threadParams->window.localDimensions.offset[d] + globalSlideOffset[d];
+        splashGlobalDomainOffset[d] = threadParams->window.globalDimensions.offset[d] + globalSlideOffset[d];
+        splashGlobalDomainSize[d] = threadParams->window.globalDimensions.size[d];
+        splashDomainSize[d] = threadParams->window.localDimensions.size[d];
+    }
+
+    splashLocalDomain = splash::Domain(splashDomainOffset, splashDomainSize);
+    splashGlobalDomain = splash::Domain(splashGlobalDomainOffset, splashGlobalDomainSize);
+}
+
 /** write attribute of a particle to hdf5 file
  *
  * @tparam T_Identifier identifier of a particle attribute
@@ -80,28 +120,9 @@ struct ParticleAttribute
 
         std::vector<double> unit = Unit<T_Identifier>::get();
 
-        /* globalSlideOffset due to gpu slides between origin at time step 0
-         * and origin at current time step
-         * ATTENTION: splash offset are globalSlideOffset + picongpu offsets
-         */
-        DataSpace<simDim> globalSlideOffset;
-        const PMacc::Selection<simDim>& localDomain = Environment<simDim>::get().SubGrid().getLocalDomain();
-        const uint32_t numSlides = MovingWindow::getInstance().getSlideCounter(threadParams->currentStep);
-        globalSlideOffset.y() += numSlides * localDomain.size.y();
-
-        Dimensions splashDomainOffset(0, 0, 0);
-        Dimensions splashGlobalDomainOffset(0, 0, 0);
-
-        Dimensions splashDomainSize(1, 1, 1);
-        Dimensions splashGlobalDomainSize(1, 1, 1);
-
-        for (uint32_t d = 0; d < simDim; ++d)
-        {
-            splashDomainOffset[d] = threadParams->window.localDimensions.offset[d] + globalSlideOffset[d];
-            splashGlobalDomainOffset[d] = threadParams->window.globalDimensions.offset[d] + globalSlideOffset[d];
-            splashGlobalDomainSize[d] = threadParams->window.globalDimensions.size[d];
-            splashDomainSize[d] = threadParams->window.localDimensions.size[d];
-        }
+        splash::Domain splashLocalDomain;
+        splash::Domain splashGlobalDomain;
+        getParticleDomains(threadParams, splashLocalDomain, splashGlobalDomain);
 
         typedef typename GetComponentsType<ValueType>::type ComponentValueType;
 
@@ -125,14 +146,8 @@ struct ParticleAttribute
                                                      1u,
                                                      splash::Selection(Dimensions(elements, 1, 1)),
                                                      datasetName.str().c_str(),
-                                                     splash::Domain(
-                                                            splashDomainOffset,
-                                                            splashDomainSize
-                                                     ),
-                                                     splash::Domain(
-                                                            splashGlobalDomainOffset,
-                                                            splashGlobalDomainSize
-                                                     ),
+                                                     splashLocalDomain,
+                                                     splashGlobalDomain,
                                                      DomainCollector::PolyType,
                                                      tmpArray);
 
@@ -152,6 +167,137 @@ struct ParticleAttribute
 
 };
 
+/** reserve the datasets of a particle attribute for chunked writing
+ *
+ * Collective operation, each rank reserves space for its particles.
+ * The datasets are filled with AppendParticleAttribute.
+ *
+ * @tparam T_Identifier identifier of a particle attribute
+ */
+template< typename T_Identifier>
+struct ReserveParticleAttribute
+{
+
+    /** reserve attribute in hdf5 file
+     *
+     * @param params wrapped params with domainwriter, ...
+     * @param subGroup group of the species
+     * @param elements number of particles of this rank
+     * @param[out] globalOffset offset of the particles of this rank in the datasets
+     */
+    HINLINE void operator()(
+                            ThreadParams* params,
+                            const std::string subGroup,
+                            const size_t elements,
+                            size_t& globalOffset)
+    {
+        typedef T_Identifier Identifier;
+        typedef typename Identifier::type ValueType;
+        const uint32_t components = GetNComponents<ValueType>::value;
+        typedef typename GetComponentsType<ValueType>::type ComponentType;
+        typedef typename PICToSplash<ComponentType>::type SplashType;
+
+        SplashType splashType;
+        const std::string name_lookup[] = {"x", "y", "z"};
+
+        std::vector<double> unit = Unit<T_Identifier>::get();
+
+        splash::Domain splashLocalDomain;
+        splash::Domain splashGlobalDomain;
+        getParticleDomains(params, splashLocalDomain, splashGlobalDomain);
+
+        for (uint32_t d = 0; d < components; d++)
+        {
+            std::stringstream datasetName;
+            datasetName << subGroup << "/" << T_Identifier::getName();
+            if (components > 1)
+                datasetName << "/" << name_lookup[d];
+
+            Dimensions splashGlobalSize;
+            Dimensions splashGlobalOffset;
+            params->dataCollector->reserveDomain(params->currentStep,
+                                                 Dimensions(elements, 1, 1),
+                                                 &splashGlobalSize,
+                                                 &splashGlobalOffset,
+                                                 1u,
+                                                 splashType,
+                                                 datasetName.str().c_str(),
+                                                 splashGlobalDomain,
+                                                 DomainCollector::PolyType);
+            globalOffset = splashGlobalOffset[0];
+
+            ColTypeDouble ctDouble;
+            if (unit.size() >= (d + 1))
+                params->dataCollector->writeAttribute(params->currentStep,
+                                                      ctDouble, datasetName.str().c_str(),
+                                                      "sim_unit", &(unit.at(d)));
+        }
+    }
+};
+
+/** append a chunk of particles to the reserved datasets of an attribute
+ *
+ * Collective operation, ranks without particles in this chunk must
+ * call it with zero elements.
+ *
+ * @tparam T_Identifier identifier of a particle attribute
+ */
+template< typename T_Identifier>
+struct AppendParticleAttribute
+{
+
+    /** append attribute to hdf5 file
+     *
+     * @param params wrapped params with domainwriter, ...
+     * @param frame frame with the particles of the chunk
+     * @param subGroup group of the species
+     * @param elements number of particles in the chunk
+     * @param globalOffset offset of the chunk in the datasets
+     * @param tmpBuffer host buffer with at least elements * sizeof(ValueType) byte
+     */
+    template<typename FrameType>
+    HINLINE void operator()(
+                            ThreadParams* params,
+                            FrameType& frame,
+                            const std::string subGroup,
+                            const size_t elements,
+                            const size_t globalOffset,
+                            std::vector<char>& tmpBuffer)
+    {
+        typedef T_Identifier Identifier;
+        typedef typename Identifier::type ValueType;
+        const uint32_t components = GetNComponents<ValueType>::value;
+        typedef typename GetComponentsType<ValueType>::type ComponentValueType;
+
+        const std::string name_lookup[] = {"x", "y", "z"};
+
+        if (tmpBuffer.size() < elements * sizeof (ComponentValueType))
+            tmpBuffer.resize(elements * sizeof (ComponentValueType));
+        ComponentValueType* tmpArray = (ComponentValueType*) (tmpBuffer.empty() ? NULL : &(tmpBuffer[0]));
+
+        for (uint32_t d = 0; d < components; d++)
+        {
+            std::stringstream datasetName;
+            datasetName << subGroup << "/" << T_Identifier::getName();
+            if (components > 1)
+                datasetName << "/" << name_lookup[d];
+
+            ValueType* dataPtr = frame.getIdentifier(Identifier()).getPointer();
+            for (size_t i = 0; i < elements; ++i)
+            {
+                tmpArray[i] = ((ComponentValueType*)dataPtr)[i * components + d];
+            }
+
+            params->dataCollector->append(params->currentStep,
+                                          Dimensions(elements, 1, 1),
+                                          1u,
+                                          Dimensions(globalOffset, 0, 0),
+                                          datasetName.str().c_str(),
+                                          tmpArray);
+        }
+    }
+};
+
 } //namspace hdf5
 
 } //namespace picongpu
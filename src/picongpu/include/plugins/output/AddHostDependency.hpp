@@ -0,0 +1,53 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "types.h"
+#include "simulation_defines.hpp"
+#include "pluginSystem/INotify.hpp"
+
+namespace picongpu
+{
+using namespace PMacc;
+
+/** add a host dependency for the dataset T_Data to a DataDependencies list
+ *
+ * usage: ForEach<FieldSeq, AddHostDependency<bmpl::_1> >
+ */
+template<typename T_Data>
+struct AddHostDependency
+{
+    HINLINE void operator()(DataDependencies& dependencies) const
+    {
+        dependencies.push_back(DataDependency(T_Data::getName(), DataDependency::HOST));
+    }
+
+    /** depend on a region of the dataset only
+     *
+     * @param region region of the data including the guarding cells
+     */
+    HINLINE void operator()(DataDependencies& dependencies, const Selection<simDim>& region) const
+    {
+        dependencies.push_back(DataDependency(T_Data::getName(), region));
+    }
+};
+
+} //namespace picongpu
@@ -27,6 +27,8 @@
 #include "simulation_defines.hpp"
 
 #include <mpi.h>
+#include <algorithm>
+#include <vector>
 #include "mappings/simulation/GridController.hpp"
 
 //c includes
@@ -41,7 +43,7 @@ using namespace PMacc;
 struct GatherSlice
 {
 
-    GatherSlice() : mpiRank(-1), numRanks(0), filteredData(NULL), comm(MPI_COMM_NULL), fullData(NULL), isMPICommInitialized(false)
+    GatherSlice() : mpiRank(-1), numRanks(0), filteredData(NULL), comm(MPI_COMM_NULL), fullData(NULL), stripData(NULL), isMPICommInitialized(false)
     {
     }
 
@@ -55,44 +57,21 @@ struct GatherSlice
      */
     bool init(bool isActive)
     {
-        /*free old communicator of init is called again*/
+        /*reset old state if init is called again*/
         if (isMPICommInitialized)
         {
             reset();
         }
 
-        int countRanks = Environment<simDim>::get().GridController().getGpuNodes().productOfComponents();
-        int gatherRanks[countRanks];
-        int groupRanks[countRanks];
-        mpiRank = Environment<simDim>::get().GridController().getGlobalRank();
-        if (!isActive)
-            mpiRank = -1;
+        /* shared with all other slices over the same ranks */
+        comm = Environment<simDim>::get().CommunicatorRegistry().getParticipants(isActive);
 
-        MPI_CHECK(MPI_Allgather(&mpiRank, 1, MPI_INT, gatherRanks, 1, MPI_INT, MPI_COMM_WORLD));
-
-        for (int i = 0; i < countRanks; ++i)
-        {
-            if (gatherRanks[i] != -1)
-            {
-                groupRanks[numRanks] = gatherRanks[i];
-                numRanks++;
-            }
-        }
-
-        MPI_Group group = MPI_GROUP_NULL;
-        MPI_Group newgroup = MPI_GROUP_NULL;
-        MPI_CHECK(MPI_Comm_group(MPI_COMM_WORLD, &group));
-        MPI_CHECK(MPI_Group_incl(group, numRanks, groupRanks, &newgroup));
-
-        MPI_CHECK(MPI_Comm_create(MPI_COMM_WORLD, newgroup, &comm));
-
-        if (mpiRank != -1)
+        if (comm != MPI_COMM_NULL)
         {
-            MPI_Comm_rank(comm, &mpiRank);
+            MPI_CHECK(MPI_Comm_rank(comm, &mpiRank));
+            MPI_CHECK(MPI_Comm_size(comm, &numRanks));
             isMPICommInitialized = true;
         }
-        MPI_CHECK(MPI_Group_free(&group));
-        MPI_CHECK(MPI_Group_free(&newgroup));
 
         return mpiRank == 0;
     }
@@ -181,6 +160,168 @@ struct GatherSlice
         return dstBox;
     }
 
+    /** composite the slice in strips of rows of the window (reduce-scatter)
+     *
+     * Instead of gathering all parts on the master, every rank of the
+     * communicator gets one strip of consecutive rows of the window image.
+     * Each part is cut into the pieces overlapping the strips and exchanged
+     * with one MPI_Alltoallv, therefore no rank holds more than one strip.
+     *
+     * @param data local part of the image (size header.node.maxSize)
+     * @param header header of the local part
+     * @param[out] stripOffset offset of the strip relative to the window
+     * @param[out] stripSize size of the strip (y can be zero)
+     * @return box with the strip, x is the fastest index
+     */
+    template<class Box >
+    Box composite(Box & data, const MessageHeader & header, Size2D& stripOffset, Size2D& stripSize)
+    {
+        typedef typename Box::ValueType ValueType;
+
+        MessageHeader* fakeHeader = MessageHeader::create();
+        memcpy(fakeHeader, &header, sizeof (MessageHeader));
+
+        char* allHeaders = new char[ MessageHeader::bytes * numRanks];
+        MPI_CHECK(MPI_Allgather(fakeHeader, MessageHeader::bytes, MPI_CHAR,
+                                allHeaders, MessageHeader::bytes, MPI_CHAR, comm));
+
+        const Size2D windowOffset(header.window.offset);
+        const Size2D windowSize(header.window.size);
+
+        int myStripBegin;
+        int myStripEnd;
+        getStripRows(mpiRank, windowOffset, windowSize, myStripBegin, myStripEnd);
+        stripOffset = Size2D(0, myStripBegin - windowOffset.y());
+        stripSize = Size2D(windowSize.x(), myStripEnd - myStripBegin);
+
+        std::vector<int> sendCounts(numRanks);
+        std::vector<int> sendDispls(numRanks);
+        std::vector<int> recvCounts(numRanks);
+        std::vector<int> recvDispls(numRanks);
+        int sendOffset = 0;
+        int recvOffset = 0;
+        for (int i = 0; i < numRanks; ++i)
+        {
+            int stripBegin;
+            int stripEnd;
+            getStripRows(i, windowOffset, windowSize, stripBegin, stripEnd);
+
+            Size2D begin;
+            Size2D end;
+            getOverlap(header.node.offset, header.node.maxSize, windowOffset, windowSize,
+                       stripBegin, stripEnd, begin, end);
+            sendCounts[i] = (end - begin).productOfComponents() * sizeof (ValueType);
+            sendDispls[i] = sendOffset;
+            sendOffset += sendCounts[i];
+
+            MessageHeader* head = (MessageHeader*) (allHeaders + MessageHeader::bytes * i);
+            getOverlap(head->node.offset, head->node.maxSize, windowOffset, windowSize,
+                       myStripBegin, myStripEnd, begin, end);
+            recvCounts[i] = (end - begin).productOfComponents() * sizeof (ValueType);
+            recvDispls[i] = recvOffset;
+            recvOffset += recvCounts[i];
+        }
+
+        /* pack the pieces for all strips */
+        ValueType* sendBuffer = new ValueType[sendOffset / sizeof (ValueType) + 1];
+        ValueType* sendPtr = sendBuffer;
+        for (int i = 0; i < numRanks; ++i)
+        {
+            int stripBegin;
+            int stripEnd;
+            getStripRows(i, windowOffset, windowSize, stripBegin, stripEnd);
+
+            Size2D begin;
+            Size2D end;
+            getOverlap(header.node.offset, header.node.maxSize, windowOffset, windowSize,
+                       stripBegin, stripEnd, begin, end);
+            for (int y = begin.y(); y < end.y(); ++y)
+                for (int x = begin.x(); x < end.x(); ++x)
+                    *(sendPtr++) = data[y - header.node.offset.y()][x - header.node.offset.x()];
+        }
+
+        ValueType* recvBuffer = new ValueType[recvOffset / sizeof (ValueType) + 1];
+        MPI_CHECK(MPI_Alltoallv(sendBuffer, &(sendCounts[0]), &(sendDispls[0]), MPI_CHAR,
+                                recvBuffer, &(recvCounts[0]), &(recvDispls[0]), MPI_CHAR, comm));
+
+        if (stripData != NULL)
+            delete[] stripData;
+        stripData = (char*) new ValueType[stripSize.productOfComponents() + 1];
+
+        Box stripBox = Box(PitchedBox<ValueType, DIM2 > (
+                                                         (ValueType*) stripData,
+                                                         DataSpace<DIM2 > (),
+                                                         stripSize,
+                                                         stripSize.x() * sizeof (ValueType)
+                                                         ));
+
+        /* unpack the pieces of all parts into the own strip */
+        for (int i = 0; i < numRanks; ++i)
+        {
+            MessageHeader* head = (MessageHeader*) (allHeaders + MessageHeader::bytes * i);
+            Size2D begin;
+            Size2D end;
+            getOverlap(head->node.offset, head->node.maxSize, windowOffset, windowSize,
+                       myStripBegin, myStripEnd, begin, end);
+            const ValueType* recvPtr = recvBuffer + recvDispls[i] / sizeof (ValueType);
+            for (int y = begin.y(); y < end.y(); ++y)
+                for (int x = begin.x(); x < end.x(); ++x)
+                    stripBox[y - myStripBegin][x - windowOffset.x()] = *(recvPtr++);
+        }
+
+        delete[] sendBuffer;
+        delete[] recvBuffer;
+        delete[] allHeaders;
+        MessageHeader::destroy(fakeHeader);
+
+        return stripBox;
+    }
+
+    /** collect all strips created by composite() on the master
+     *
+     * The strips are consecutive rows of the window, therefore the
+     * master receives the final window image without any reordering.
+     *
+     * @param strip strip of this rank (returned by composite())
+     * @param stripSize size of the strip
+     * @param header header of the local part
+     * @return box with the window image (only valid on the master)
+     */
+    template<class Box >
+    Box gatherStrips(const Box & strip, const Size2D& stripSize, const MessageHeader & header)
+    {
+        typedef typename Box::ValueType ValueType;
+
+        const Size2D windowOffset(header.window.offset);
+        const Size2D windowSize(header.window.size);
+
+        std::vector<int> counts(numRanks);
+        std::vector<int> displs(numRanks);
+        for (int i = 0; i < numRanks; ++i)
+        {
+            int stripBegin;
+            int stripEnd;
+            getStripRows(i, windowOffset, windowSize, stripBegin, stripEnd);
+            counts[i] = (stripEnd - stripBegin) * windowSize.x() * sizeof (ValueType);
+            displs[i] = (stripBegin - windowOffset.y()) * windowSize.x() * sizeof (ValueType);
+        }
+
+        if (filteredData == NULL && mpiRank == 0)
+            filteredData = (char*) new ValueType[windowSize.productOfComponents()];
+
+        MPI_CHECK(MPI_Gatherv(
+                              stripData, stripSize.productOfComponents() * sizeof (ValueType), MPI_CHAR,
+                              filteredData, &(counts[0]), &(displs[0]), MPI_CHAR,
+                              0, comm));
+
+        return Box(PitchedBox<ValueType, DIM2 > (
+                                                 (ValueType*) filteredData,
+                                                 DataSpace<DIM2 > (),
+                                                 windowSize,
+                                                 windowSize.x() * sizeof (ValueType)
+                                                 ));
+    }
+
     template<class DstBox, class SrcBox>
     void insertData(DstBox& dst, const SrcBox& src, Size2D offsetToSimNull, Size2D srcSize)
     {
@@ -195,6 +336,31 @@ struct GatherSlice
 
 private:
 
+    /** rows [begin, end) of the window (in global image coordinates) owned by rank */
+    void getStripRows(int rank, const Size2D& windowOffset, const Size2D& windowSize, int& begin, int& end) const
+    {
+        begin = windowOffset.y() + (int) (((int64_t) windowSize.y() * rank) / numRanks);
+        end = windowOffset.y() + (int) (((int64_t) windowSize.y() * (rank + 1)) / numRanks);
+    }
+
+    /** overlap of a part of the image with a strip of the window
+     *
+     * @param[out] begin first cell of the overlap (global image coordinates)
+     * @param[out] end behind the last cell of the overlap, end == begin if there is no overlap
+     */
+    void getOverlap(const Size2D& partOffset, const Size2D& partSize,
+                    const Size2D& windowOffset, const Size2D& windowSize,
+                    int stripBegin, int stripEnd,
+                    Size2D& begin, Size2D& end) const
+    {
+        begin.x() = std::max(partOffset.x(), windowOffset.x());
+        end.x() = std::min(partOffset.x() + partSize.x(), windowOffset.x() + windowSize.x());
+        begin.y() = std::max(partOffset.y(), stripBegin);
+        end.y() = std::min(partOffset.y() + partSize.y(), stripEnd);
+        if (end.x() <= begin.x() || end.y() <= begin.y())
+            end = begin;
+    }
+
     /*reset this object und set all values to initial state*/
     void reset()
     {
@@ -206,13 +372,18 @@ private:
         if (fullData != NULL)
             delete[] fullData;
         fullData = NULL;
-        if (isMPICommInitialized)
-            MPI_CHECK(MPI_Comm_free(&comm));
+        if (stripData != NULL)
+            delete[] stripData;
+        stripData = NULL;
+        /* the communicator is owned by the CommunicatorRegistry */
+        comm = MPI_COMM_NULL;
         isMPICommInitialized = false;
     }
 
     char* filteredData;
     char* fullData;
+    /* strip of the window image owned by this rank (@see composite) */
+    char* stripData;
     MPI_Comm comm;
     int mpiRank;
     int numRanks;
@@ -0,0 +1,110 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "types.h"
+#include "simulation_defines.hpp"
+#include "simulationControl/Window.hpp"
+#include "dimensions/DataSpace.hpp"
+
+#include "particles/particleFilter/FilterFactory.hpp"
+#include "particles/particleFilter/PositionFilter.hpp"
+#include "particles/particleFilter/SubsamplingFilter.hpp"
+#include "particles/filter/MomentumConeFilter.hpp"
+#include "particles/filter/EnergyFilter.hpp"
+
+#include <boost/mpl/vector.hpp>
+#include <algorithm>
+
+namespace picongpu
+{
+using namespace PMacc;
+
+/** predicates of the particle output, @see fileOutput.param
+ *
+ * the position filter selects the moving window and the output box
+ */
+typedef bmpl::vector<
+    typename GetPositionFilter<simDim>::type,
+    SubsamplingFilter<>,
+    particles::filter::MomentumConeFilter<>,
+    particles::filter::EnergyFilter<>
+> ParticleOutputFilters;
+
+typedef typename FilterFactory<ParticleOutputFilters>::FilterType ParticleOutputFilter;
+
+/** create the filter for the particles of one dump
+ *
+ * Copy and count the particles of a dump with the same filter instance
+ * (or with instances created with the same arguments).
+ *
+ * @param window window of the dump
+ * @param localWindowToDomainOffset offset from the local moving window to the local domain
+ * @param currentStep simulation step, seed of the subsampling
+ * @param withPredicates false selects all particles of the window (e.g. for checkpoints)
+ */
+HINLINE ParticleOutputFilter createParticleOutputFilter(const Window& window,
+                                                        const DataSpace<simDim>& localWindowToDomainOffset,
+                                                        uint32_t currentStep,
+                                                        bool withPredicates = true)
+{
+    using namespace particleOutputFilter;
+
+    ParticleOutputFilter filter;
+    /* the position filter is always needed because of the moving window */
+    filter.setStatus(true);
+
+    DataSpace<simDim> begin(localWindowToDomainOffset);
+    DataSpace<simDim> end(localWindowToDomainOffset + window.localDimensions.size);
+
+    if (withPredicates)
+    {
+        const DataSpace<DIM3> boxOffset(BOX_OFFSET_X, BOX_OFFSET_Y, BOX_OFFSET_Z);
+        const DataSpace<DIM3> boxSize(BOX_SIZE_X, BOX_SIZE_Y, BOX_SIZE_Z);
+        bool boxActive = true;
+        for (uint32_t d = 0; d < simDim; ++d)
+            boxActive = boxActive && boxSize[d] != 0;
+
+        if (boxActive)
+        {
+            /* box is relative to the window origin, the position filter to the local domain */
+            const DataSpace<simDim> localDomainOffset(Environment<simDim>::get().SubGrid().getLocalDomain().offset);
+            for (uint32_t d = 0; d < simDim; ++d)
+            {
+                const int windowToDomain = localDomainOffset[d] - window.globalDimensions.offset[d];
+                begin[d] = std::max(begin[d], boxOffset[d] - windowToDomain);
+                end[d] = std::min(end[d], boxOffset[d] + boxSize[d] - windowToDomain);
+                end[d] = std::max(begin[d], end[d]);
+            }
+        }
+
+        filter.setSubsampling(SUBSAMPLING_RATE, currentStep);
+        filter.setMomentumCone(float3_X(CONE_DIRECTION_X, CONE_DIRECTION_Y, CONE_DIRECTION_Z),
+                               CONE_HALF_ANGLE);
+        filter.setEnergyRange(MIN_ENERGY, MAX_ENERGY);
+    }
+
+    filter.setWindowPosition(begin, end - begin);
+    return filter;
+}
+
+} //namespace picongpu
@@ -96,6 +96,16 @@ struct FreeMemory
     }
 };
 
+/** add the size in byte of one attribute to the given size */
+template<typename T_Type>
+struct AddAttributeSize
+{
+    HINLINE void operator()(size_t& size) const
+    {
+        size += sizeof (typename T_Type::type);
+    }
+};
+
 /*functor to create a pair for a MapTuple map*/
 struct OperatorCreateVectorBox
 {
@@ -0,0 +1,61 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <string.h>
+
+namespace picongpu
+{
+namespace compression
+{
+
+/** byte shuffle pre-filter
+ *
+ * Stores byte k of all elements contiguously (all exponents of a float
+ * array side by side), which makes floating point data much better
+ * compressible. Trailing bytes which do not form a full element are
+ * copied unchanged.
+ */
+struct ByteShuffle
+{
+
+    static void shuffle(char* out, const char* in, size_t bytes, size_t typeSize)
+    {
+        const size_t numElements = bytes / typeSize;
+        for (size_t b = 0; b < typeSize; ++b)
+            for (size_t i = 0; i < numElements; ++i)
+                out[b * numElements + i] = in[i * typeSize + b];
+        memcpy(out + numElements * typeSize, in + numElements * typeSize, bytes - numElements * typeSize);
+    }
+
+    static void unshuffle(char* out, const char* in, size_t bytes, size_t typeSize)
+    {
+        const size_t numElements = bytes / typeSize;
+        for (size_t b = 0; b < typeSize; ++b)
+            for (size_t i = 0; i < numElements; ++i)
+                out[i * typeSize + b] = in[b * numElements + i];
+        memcpy(out + numElements * typeSize, in + numElements * typeSize, bytes - numElements * typeSize);
+    }
+};
+
+} //namespace compression
+} //namespace picongpu
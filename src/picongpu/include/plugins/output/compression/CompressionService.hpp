@@ -0,0 +1,462 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <vector>
+#include <algorithm>
+
+#include "plugins/output/compression/ZipConnector.hpp"
+#include "plugins/output/compression/ByteShuffle.hpp"
+
+namespace picongpu
+{
+namespace compression
+{
+
+/** codec of a compressed frame
+ *
+ * the ids are part of the frame format and must never change
+ */
+enum Codec
+{
+    CODEC_NONE = 0,
+    CODEC_ZLIB = 1
+};
+
+/** header in front of every compressed frame
+ *
+ * The header is followed by numChunks uint32_t compressed chunk sizes
+ * and the chunk data. A chunk with a compressed size equal to its raw size
+ * is stored uncompressed.
+ */
+struct FrameHeader
+{
+    /* magic number "PICZ" */
+    static const uint32_t magicNumber = 0x5a434950;
+
+    uint32_t magic;
+    uint8_t codec;
+    /* element size of the shuffle filter, 1 means no shuffle */
+    uint8_t typeSize;
+    uint16_t reserved;
+    uint32_t chunkSize;
+    uint32_t numChunks;
+    uint64_t rawSize;
+};
+
+/** compress buffers chunk-wise on several threads
+ *
+ * Every thread owns a pooled codec context (ZipConnector) which is reused
+ * for all chunks and calls. The calling thread works on chunks, too.
+ * compress()/decompress() are not reentrant, use one service per
+ * thread which compresses.
+ */
+class CompressionService
+{
+public:
+
+    /** constructor
+     *
+     * @param numThreads number of threads which compress (including the caller)
+     * @param chunkSize raw bytes per chunk, chunks are compressed independently
+     */
+    CompressionService(uint32_t numThreads = 1, uint32_t chunkSize = 1024 * 1024) :
+    chunkSize(chunkSize), nextChunk(0), numChunks(0), chunksDone(0),
+    generation(0), stop(false), jobFailed(false)
+    {
+        pthread_mutex_init(&mutex, NULL);
+        pthread_cond_init(&workCond, NULL);
+        pthread_cond_init(&doneCond, NULL);
+
+        numThreads = std::max(numThreads, 1u);
+        for (uint32_t i = 0; i < numThreads; ++i)
+            workers.push_back(new Worker(this));
+        /* worker 0 is the calling thread */
+        for (uint32_t i = 1; i < numThreads; ++i)
+            pthread_create(&(workers[i]->thread), NULL, runWorker, workers[i]);
+    }
+
+    virtual ~CompressionService()
+    {
+        pthread_mutex_lock(&mutex);
+        stop = true;
+        pthread_cond_broadcast(&workCond);
+        pthread_mutex_unlock(&mutex);
+
+        for (size_t i = 0; i < workers.size(); ++i)
+        {
+            if (i != 0)
+                pthread_join(workers[i]->thread, NULL);
+            delete workers[i];
+        }
+        pthread_cond_destroy(&doneCond);
+        pthread_cond_destroy(&workCond);
+        pthread_mutex_destroy(&mutex);
+    }
+
+    /** upper bound of the frame size for rawSize bytes */
+    size_t maxCompressedSize(size_t rawSize) const
+    {
+        const size_t chunks = getNumChunks(rawSize);
+        return sizeof (FrameHeader) + chunks * sizeof (uint32_t) +
+            chunks * ZipConnector::maxCompressedSize(chunkSize);
+    }
+
+    /** compress a buffer to a self-describing frame
+     *
+     * @param out output buffer with at least maxCompressedSize(rawSize) bytes
+     * @param in raw data
+     * @param rawSize bytes in in
+     * @param codec codec of all chunks
+     * @param level compression level of the codec
+     * @param typeSize element size for the byte shuffle filter (e.g. sizeof(float)),
+     *                 1 disables the filter
+     * @return size of the frame in byte
+     */
+    size_t compress(void* out, const void* in, size_t rawSize,
+                    Codec codec, int level, uint32_t typeSize = 1)
+    {
+        FrameHeader* header = (FrameHeader*) out;
+        header->magic = FrameHeader::magicNumber;
+        header->codec = (uint8_t) codec;
+        header->typeSize = (uint8_t) std::max(typeSize, 1u);
+        header->reserved = 0;
+        header->chunkSize = chunkSize;
+        header->numChunks = getNumChunks(rawSize);
+        header->rawSize = rawSize;
+
+        const size_t maxChunk = ZipConnector::maxCompressedSize(chunkSize);
+        staging.resize(header->numChunks * maxChunk);
+        chunkBytes.resize(header->numChunks);
+
+        job.compress = true;
+        job.in = (const char*) in;
+        job.out = staging.empty() ? NULL : &(staging[0]);
+        job.rawSize = rawSize;
+        job.codec = codec;
+        job.level = level;
+        job.typeSize = header->typeSize;
+        job.maxChunk = maxChunk;
+        run(header->numChunks);
+
+        /* pack the chunks behind the chunk size table */
+        uint32_t* table = (uint32_t*) (header + 1);
+        char* data = (char*) (table + header->numChunks);
+        for (uint32_t i = 0; i < header->numChunks; ++i)
+        {
+            table[i] = chunkBytes[i];
+            memcpy(data, &(staging[i * maxChunk]), chunkBytes[i]);
+            data += chunkBytes[i];
+        }
+        return data - (char*) out;
+    }
+
+    /** compress a buffer to a plain zlib stream on the calling thread
+     *
+     * For receivers which expect one zlib stream without a frame header.
+     *
+     * @param out output buffer
+     * @param in raw data
+     * @param rawSize bytes in in
+     * @param maxOut size of out, ZipConnector::maxCompressedSize(rawSize) is always large enough
+     * @param level zlib compression level
+     * @return size of the stream in byte, 0 if out was too small
+     */
+    size_t compressStream(void* out, const void* in, size_t rawSize, size_t maxOut, int level)
+    {
+        return workers[0]->zip.compress(out, (void*) in, rawSize, maxOut, level);
+    }
+
+    /** raw size of a frame
+     *
+     * @param frame compressed frame
+     * @param frameBytes number of bytes available in frame
+     * @return raw size, 0 if frame is not a valid frame
+     */
+    static size_t getRawSize(const void* frame, size_t frameBytes)
+    {
+        if (!isValidFrame(frame, frameBytes))
+            return 0;
+        return ((const FrameHeader*) frame)->rawSize;
+    }
+
+    /** decompress a frame created by compress()
+     *
+     * @param out output buffer with at least getRawSize(frame, frameBytes) bytes
+     * @param frame compressed frame
+     * @param frameBytes number of bytes available in frame
+     * @return number of raw bytes, 0 if the frame is invalid or a chunk is corrupt
+     */
+    size_t decompress(void* out, const void* frame, size_t frameBytes)
+    {
+        if (!isValidFrame(frame, frameBytes))
+            return 0;
+        const FrameHeader* header = (const FrameHeader*) frame;
+
+        const uint32_t* table = (const uint32_t*) (header + 1);
+        chunkOffsets.resize(header->numChunks);
+        size_t offset = 0;
+        for (uint32_t i = 0; i < header->numChunks; ++i)
+        {
+            chunkOffsets[i] = offset;
+            offset += table[i];
+        }
+        chunkBytes.assign(table, table + header->numChunks);
+
+        job.compress = false;
+        job.in = (const char*) (table + header->numChunks);
+        job.out = (char*) out;
+        job.rawSize = header->rawSize;
+        job.codec = (Codec) header->codec;
+        job.typeSize = header->typeSize;
+        job.frameChunkSize = header->chunkSize;
+        run(header->numChunks);
+
+        return jobFailed ? 0 : header->rawSize;
+    }
+
+private:
+
+    struct Worker
+    {
+
+        Worker(CompressionService* service) : service(service), seenGeneration(0)
+        {
+        }
+
+        CompressionService* service;
+        pthread_t thread;
+        uint32_t seenGeneration;
+        /* pooled codec context */
+        ZipConnector zip;
+        /* temporary buffer for the shuffle filter */
+        std::vector<char> shuffled;
+    };
+
+    /** parameters of the current compress/decompress call */
+    struct Job
+    {
+        bool compress;
+        const char* in;
+        char* out;
+        size_t rawSize;
+        Codec codec;
+        int level;
+        uint32_t typeSize;
+        size_t maxChunk;
+        uint32_t frameChunkSize;
+    };
+
+    /* not copyable, the threads use the address of this object */
+    CompressionService(const CompressionService&);
+    CompressionService& operator=(const CompressionService&);
+
+    /** check that header, chunk size table and payload are consistent
+     * and within frameBytes
+     */
+    static bool isValidFrame(const void* frame, size_t frameBytes)
+    {
+        if (frameBytes < sizeof (FrameHeader))
+            return false;
+        const FrameHeader* header = (const FrameHeader*) frame;
+        if (header->magic != FrameHeader::magicNumber || header->chunkSize == 0 ||
+            header->codec > CODEC_ZLIB)
+            return false;
+
+        const uint64_t rawSize = header->rawSize;
+        const uint64_t chunkSize = header->chunkSize;
+        const uint64_t chunks = rawSize / chunkSize + (rawSize % chunkSize != 0 ? 1 : 0);
+        if (chunks != header->numChunks)
+            return false;
+
+        const uint64_t tableEnd = sizeof (FrameHeader) + chunks * sizeof (uint32_t);
+        if (tableEnd > frameBytes)
+            return false;
+
+        const uint32_t* table = (const uint32_t*) (header + 1);
+        uint64_t payloadBytes = 0;
+        for (uint32_t i = 0; i < header->numChunks; ++i)
+        {
+            const uint64_t chunkBytes = std::min(chunkSize, rawSize - i * chunkSize);
+            if (table[i] > chunkBytes)
+                return false;
+            payloadBytes += table[i];
+        }
+        return payloadBytes <= frameBytes - tableEnd;
+    }
+
+    uint32_t getNumChunks(size_t rawSize) const
+    {
+        return (rawSize + chunkSize - 1) / chunkSize;
+    }
+
+    /** process all chunks of job with the pool and the calling thread */
+    void run(uint32_t chunks)
+    {
+        pthread_mutex_lock(&mutex);
+        nextChunk = 0;
+        numChunks = chunks;
+        chunksDone = 0;
+        jobFailed = false;
+        ++generation;
+        pthread_cond_broadcast(&workCond);
+        pthread_mutex_unlock(&mutex);
+
+        processChunks(*workers[0]);
+
+        pthread_mutex_lock(&mutex);
+        while (chunksDone != numChunks)
+            pthread_cond_wait(&doneCond, &mutex);
+        pthread_mutex_unlock(&mutex);
+    }
+
+    static void* runWorker(void* ptr)
+    {
+        Worker* worker = (Worker*) ptr;
+        CompressionService* service = worker->service;
+
+        pthread_mutex_lock(&service->mutex);
+        while (true)
+        {
+            while (worker->seenGeneration == service->generation && !service->stop)
+                pthread_cond_wait(&service->workCond, &service->mutex);
+            if (service->stop)
+                break;
+            worker->seenGeneration = service->generation;
+            pthread_mutex_unlock(&service->mutex);
+
+            service->processChunks(*worker);
+
+            pthread_mutex_lock(&service->mutex);
+        }
+        pthread_mutex_unlock(&service->mutex);
+        return NULL;
+    }
+
+    void processChunks(Worker& worker)
+    {
+        while (true)
+        {
+            pthread_mutex_lock(&mutex);
+            if (nextChunk >= numChunks)
+            {
+                pthread_mutex_unlock(&mutex);
+                return;
+            }
+            uint32_t chunk = nextChunk++;
+            pthread_mutex_unlock(&mutex);
+
+            bool ok = true;
+            if (job.compress)
+                compressChunk(worker, chunk);
+            else
+                ok = decompressChunk(worker, chunk);
+
+            pthread_mutex_lock(&mutex);
+            if (!ok)
+                jobFailed = true;
+            ++chunksDone;
+            if (chunksDone == numChunks)
+                pthread_cond_signal(&doneCond);
+            pthread_mutex_unlock(&mutex);
+        }
+    }
+
+    void compressChunk(Worker& worker, uint32_t chunk)
+    {
+        const size_t offset = (size_t) chunk * chunkSize;
+        const size_t bytes = std::min((size_t) chunkSize, job.rawSize - offset);
+        const char* src = job.in + offset;
+        char* dst = job.out + chunk * job.maxChunk;
+
+        if (job.typeSize > 1)
+        {
+            worker.shuffled.resize(chunkSize);
+            ByteShuffle::shuffle(&(worker.shuffled[0]), src, bytes, job.typeSize);
+            src = &(worker.shuffled[0]);
+        }
+
+        size_t compressed = 0;
+        if (job.codec == CODEC_ZLIB)
+            compressed = worker.zip.compress(dst, (void*) src, bytes, job.maxChunk, job.level);
+
+        /* store incompressible chunks raw */
+        if (compressed == 0 || compressed >= bytes)
+        {
+            memcpy(dst, src, bytes);
+            compressed = bytes;
+        }
+        chunkBytes[chunk] = (uint32_t) compressed;
+    }
+
+    /** @return false if the chunk is corrupt */
+    bool decompressChunk(Worker& worker, uint32_t chunk)
+    {
+        const size_t offset = (size_t) chunk * job.frameChunkSize;
+        const size_t bytes = std::min((size_t) job.frameChunkSize, job.rawSize - offset);
+        const char* src = job.in + chunkOffsets[chunk];
+        char* dst = job.out + offset;
+
+        char* raw = dst;
+        if (job.typeSize > 1)
+        {
+            worker.shuffled.resize(job.frameChunkSize);
+            raw = &(worker.shuffled[0]);
+        }
+
+        if (chunkBytes[chunk] == bytes)
+            memcpy(raw, src, bytes);
+        else if (worker.zip.decompress(raw, (void*) src, chunkBytes[chunk], bytes) != bytes)
+            return false;
+
+        if (job.typeSize > 1)
+            ByteShuffle::unshuffle(dst, raw, bytes, job.typeSize);
+        return true;
+    }
+
+    uint32_t chunkSize;
+    std::vector<Worker*> workers;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t workCond;
+    pthread_cond_t doneCond;
+    /* guarded by mutex */
+    uint32_t nextChunk;
+    uint32_t numChunks;
+    uint32_t chunksDone;
+    uint32_t generation;
+    bool stop;
+    /* a chunk of the current job could not be decompressed */
+    bool jobFailed;
+
+    /* written by the caller before the workers start */
+    Job job;
+    std::vector<size_t> chunkOffsets;
+    /* compressed size of each chunk, every chunk is written by one thread */
+    std::vector<uint32_t> chunkBytes;
+    std::vector<char> staging;
+};
+
+} //namespace compression
+} //namespace picongpu
@@ -24,67 +24,127 @@
 #include <cassert>
 #include "zlib.h"
 
+/** zlib deflate/inflate
+ *
+ * The zlib streams are created with the first call and reused
+ * (deflateReset/inflateReset) for all following calls.
+ */
 class ZipConnector
 {
 public:
 
+    ZipConnector() : deflateLevel(-1), deflateReady(false), inflateReady(false)
+    {
+    }
+
+    virtual ~ZipConnector()
+    {
+        if (deflateReady)
+            (void) deflateEnd(&deflateStrm);
+        if (inflateReady)
+            (void) inflateEnd(&inflateStrm);
+    }
+
+    /** upper bound of the compressed size for sizeIn input bytes */
+    static size_t maxCompressedSize(size_t sizeIn)
+    {
+        return compressBound(sizeIn);
+    }
+
     size_t compress(void* out, void* in, size_t sizeIn, int compressLevel)
     {
-        int ret;
+        return compress(out, in, sizeIn, sizeIn, compressLevel);
+    }
 
-        z_stream strm;
+    /** compress sizeIn bytes
+     *
+     * @param sizeOut size of the output buffer, maxCompressedSize(sizeIn)
+     *                is always large enough
+     * @return number of compressed bytes, 0 if the output buffer was too small
+     */
+    size_t compress(void* out, void* in, size_t sizeIn, size_t sizeOut, int compressLevel)
+    {
+        int ret;
 
-        strm.zalloc = Z_NULL;
-        strm.zfree = Z_NULL;
-        strm.opaque = Z_NULL;
-        ret = deflateInit(&strm, compressLevel);
+        if (deflateReady && deflateLevel != compressLevel)
+        {
+            (void) deflateEnd(&deflateStrm);
+            deflateReady = false;
+        }
+
+        if (deflateReady)
+            ret = deflateReset(&deflateStrm);
+        else
+        {
+            deflateStrm.zalloc = Z_NULL;
+            deflateStrm.zfree = Z_NULL;
+            deflateStrm.opaque = Z_NULL;
+            ret = deflateInit(&deflateStrm, compressLevel);
+            deflateReady = (ret == Z_OK);
+            deflateLevel = compressLevel;
+        }
         if (ret != Z_OK)
             return 0;
 
-        strm.avail_in = sizeIn;
-        strm.next_in = (Bytef*) in;
+        deflateStrm.avail_in = sizeIn;
+        deflateStrm.next_in = (Bytef*) in;
 
-        strm.avail_out = sizeIn;
-        strm.next_out = (Bytef*) out;
+        deflateStrm.avail_out = sizeOut;
+        deflateStrm.next_out = (Bytef*) out;
 
-        ret = deflate(&strm, Z_FINISH);
+        ret = deflate(&deflateStrm, Z_FINISH);
         assert(ret != Z_STREAM_ERROR);
 
-        size_t compressedBytes = strm.total_out;
-
-        (void) deflateEnd(&strm);
-        return compressedBytes;
+        return ret == Z_STREAM_END ? deflateStrm.total_out : 0;
     }
 
+    /** decompress sizeIn bytes
+     *
+     * @param sizeOut size of the output buffer
+     * @return number of decompressed bytes, 0 if the input is corrupt or
+     *         truncated or the output buffer was too small
+     */
     size_t decompress(void* out, void* in, size_t sizeIn,size_t sizeOut)
     {
         int ret;
 
-        z_stream strm;
-        /* allocate deflate state */
-        strm.zalloc = Z_NULL;
-        strm.zfree = Z_NULL;
-        strm.opaque = Z_NULL;
-        ret = inflateInit(&strm);
+        if (inflateReady)
+            ret = inflateReset(&inflateStrm);
+        else
+        {
+            /* allocate inflate state */
+            inflateStrm.zalloc = Z_NULL;
+            inflateStrm.zfree = Z_NULL;
+            inflateStrm.opaque = Z_NULL;
+            inflateStrm.avail_in = 0;
+            inflateStrm.next_in = Z_NULL;
+            ret = inflateInit(&inflateStrm);
+            inflateReady = (ret == Z_OK);
+        }
         if (ret != Z_OK)
             return 0;
 
-        strm.avail_in = sizeIn;
-
-        strm.next_in = (Bytef*) in;
+        inflateStrm.avail_in = sizeIn;
+        inflateStrm.next_in = (Bytef*) in;
 
-        strm.avail_out = sizeOut;
-        strm.next_out = (Bytef*) out;
-        ret = inflate(&strm, Z_FINISH);
+        inflateStrm.avail_out = sizeOut;
+        inflateStrm.next_out = (Bytef*) out;
+        ret = inflate(&inflateStrm, Z_FINISH);
         assert(ret != Z_STREAM_ERROR);
 
-        size_t uncompressedBytes = strm.total_out;
-
-        (void) inflateEnd(&strm);
-        return uncompressedBytes;
+        return ret == Z_STREAM_END ? inflateStrm.total_out : 0;
     }
 
 private:
 
+    /* the zlib streams are not copyable */
+    ZipConnector(const ZipConnector&);
+    ZipConnector& operator=(const ZipConnector&);
+
+    z_stream deflateStrm;
+    z_stream inflateStrm;
+    int deflateLevel;
+    bool deflateReady;
+    bool inflateReady;
 };
 
@@ -33,6 +33,8 @@
 #include "memory/boxes/PitchedBox.hpp"
 #include "memory/boxes/DataBox.hpp"
 
+#include <vector>
+
 
 namespace picongpu
 {
@@ -53,13 +55,24 @@ namespace picongpu
 
     struct LiveViewClient
     {
-
-        LiveViewClient(std::string ip, std::string port) : socket(NULL), ip(ip), port(port)
+        /* the live view needs the full image from one rank */
+        static const bool supportsTiles = false;
+
+        LiveViewClient(std::string ip, std::string port, int compressLevel = Z_BEST_SPEED,
+                       SocketConnector::Encoding encoding = SocketConnector::ENCODING_ZLIB,
+                       uint32_t numThreads = 1) :
+        socket(NULL), ip(ip), port(port), compressLevel(compressLevel),
+        encoding(encoding), numThreads(numThreads)
         {
         }
 
         virtual ~LiveViewClient()
         {
+            if (socket)
+            {
+                log<picLog::INPUT_OUTPUT > ("LiveView %1%:%2%: %3% images sent, %4% dropped") %
+                    ip % port % socket->getNumSent() % socket->getNumDropped();
+            }
             __delete(socket);
         }
 
@@ -73,6 +86,11 @@ namespace picongpu
         SocketConnector *socket;
         std::string ip;
         std::string port;
+        int compressLevel;
+        SocketConnector::Encoding encoding;
+        uint32_t numThreads;
+        /* message buffer, reused for all images */
+        std::vector<char> message;
     };
 
     template<>
@@ -83,10 +101,12 @@ namespace picongpu
                                                                                    )
     {
         if (!socket)
-            socket = new SocketConnector(ip, port);
+            socket = new SocketConnector(ip, port, compressLevel, encoding, numThreads);
 
         size_t elems = MessageHeader::bytes + header.window.size.productOfComponents() * sizeof (uint8_t3);
-        char *array = new char[elems];
+        if (message.size() < elems)
+            message.resize(elems);
+        char *array = &(message[0]);
 
         MessageHeader * fakeHeader = (MessageHeader*) array;
 
@@ -109,8 +129,8 @@ namespace picongpu
                 smallPic[y ][x].z = (uint8_t) (data[y ][x ].z() * 255.f);
             }
         }
+        /* returns immediately, the image is sent by a background thread */
         socket->send(array, elems);
-        delete[] array;
     }
 }
 
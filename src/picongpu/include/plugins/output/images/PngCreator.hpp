@@ -36,6 +36,10 @@
 #include <sstream>
 
 #include <iomanip>
+#include <vector>
+#include <list>
+#include <algorithm>
+#include <pthread.h>
 
 #include "memory/boxes/PitchedBox.hpp"
 #include "memory/boxes/DataBox.hpp"
@@ -50,13 +54,56 @@ namespace picongpu
 
     struct PngCreator
     {
+        /* every rank can write a part of the image to an own file */
+        static const bool supportsTiles = true;
+
+        /* number of background threads which encode and write images */
+        static const uint32_t numEncoderThreads = 2;
+        /* maximal number of images waiting for encoding,
+         * new images are dropped if the queue is full */
+        static const uint32_t maxQueueSize = 4;
+
+        PngCreator(std::string name, std::string folder) :
+        name(folder + "/" + name), folder(folder), createFolder(true),
+        threadsStarted(false), shutdown(false),
+        numEncoded(0), numDropped(0), maxQueueDepth(0)
+        {
+            pthread_mutex_init(&queueMutex, NULL);
+            pthread_cond_init(&queueCond, NULL);
+        }
 
-        PngCreator(std::string name, std::string folder) : name(folder + "/" + name), folder(folder), createFolder(true)
+        /** copy the configuration only
+         *
+         * the encoder threads and the queue are never shared,
+         * a copy starts its own threads with the first image
+         */
+        PngCreator(const PngCreator& other) :
+        name(other.name), folder(other.folder), createFolder(other.createFolder),
+        threadsStarted(false), shutdown(false),
+        numEncoded(0), numDropped(0), maxQueueDepth(0)
         {
+            pthread_mutex_init(&queueMutex, NULL);
+            pthread_cond_init(&queueCond, NULL);
         }
 
         ~PngCreator()
         {
+            if (threadsStarted)
+            {
+                pthread_mutex_lock(&queueMutex);
+                shutdown = true;
+                pthread_cond_broadcast(&queueCond);
+                pthread_mutex_unlock(&queueMutex);
+
+                /* all queued images are written before the threads exit */
+                for (uint32_t i = 0; i < numEncoderThreads; ++i)
+                    pthread_join(threads[i], NULL);
+
+                log<picLog::INPUT_OUTPUT > ("PngCreator %1%: %2% images written, %3% dropped, max queue depth %4%") %
+                    name % numEncoded % numDropped % maxQueueDepth;
+            }
+            pthread_cond_destroy(&queueCond);
+            pthread_mutex_destroy(&queueMutex);
         }
 
         template<class Box>
@@ -67,16 +114,135 @@ namespace picongpu
 
     private:
 
-        void resizeAndScaleImage(pngwriter* png, double scaleFactor)
+        /** copy of an image which is encoded by a background thread */
+        struct ImageJob
+        {
+            std::vector<float3_X> data;
+            Size2D size;
+            std::string filename;
+            std::string description;
+            float_X scaleX;
+            float_X scaleY;
+        };
+
+        /* the threads use the address of this object */
+        PngCreator& operator=(const PngCreator&);
+
+        static void resizeAndScaleImage(pngwriter* png, double scaleFactor)
         {
             if (scaleFactor != 1.)
                 png->scale_k(scaleFactor);
         }
 
+        /** add an image to the queue, drop it if the queue is full
+         *
+         * @return false if the image was dropped
+         */
+        bool enqueue(ImageJob* job)
+        {
+            if (!threadsStarted)
+            {
+                for (uint32_t i = 0; i < numEncoderThreads; ++i)
+                    pthread_create(&threads[i], NULL, runEncoder, this);
+                threadsStarted = true;
+            }
+
+            pthread_mutex_lock(&queueMutex);
+            const bool accepted = queue.size() < maxQueueSize;
+            if (accepted)
+            {
+                queue.push_back(job);
+                maxQueueDepth = std::max(maxQueueDepth, (uint32_t) queue.size());
+                pthread_cond_signal(&queueCond);
+            }
+            else
+                ++numDropped;
+            pthread_mutex_unlock(&queueMutex);
+
+            return accepted;
+        }
+
+        static void* runEncoder(void* ptr)
+        {
+            PngCreator* creator = (PngCreator*) ptr;
+            while (true)
+            {
+                pthread_mutex_lock(&creator->queueMutex);
+                while (creator->queue.empty() && !creator->shutdown)
+                    pthread_cond_wait(&creator->queueCond, &creator->queueMutex);
+                if (creator->queue.empty())
+                {
+                    /* shutdown and nothing left to write */
+                    pthread_mutex_unlock(&creator->queueMutex);
+                    return NULL;
+                }
+                ImageJob* job = creator->queue.front();
+                creator->queue.pop_front();
+                pthread_mutex_unlock(&creator->queueMutex);
+
+                encode(*job);
+                delete job;
+
+                pthread_mutex_lock(&creator->queueMutex);
+                ++creator->numEncoded;
+                pthread_mutex_unlock(&creator->queueMutex);
+            }
+            return NULL;
+        }
+
+        /** encode and write one image (runs in a background thread) */
+        static void encode(const ImageJob& job)
+        {
+            const Size2D& size = job.size;
+            pngwriter png(size.x(), size.y(), 0, job.filename.c_str());
+            //PngWriter coordinate system begin with 1,1
+
+            for (int y = 0; y < size.y(); ++y)
+            {
+                for (int x = 0; x < size.x(); ++x)
+                {
+                    const float3_X& p = job.data[y * size.x() + x];
+                    png.plot(x + 1, size.y() - y, p.x(), p.y(), p.z());
+                }
+            }
+
+            // scale to real cell size
+            // but, to prevent artifacts:
+            //   scale only, if at least one of
+            //   scale_x and scale_y is != 1.0
+            if (scale_to_cellsize)
+                if ((job.scaleX != float_X(1.0)) || (job.scaleY != float_X(1.0)))
+                    png.scale_kxky(job.scaleX, job.scaleY);
+
+            // global rescales to save disk space
+            resizeAndScaleImage(&png, scale_image);
+
+            char title[] = "PIConGPU preview image";
+            char author[] = "The awesome PIConGPU-Team";
+            char software[] = "PIConGPU with PNGwriter";
+
+            png.settext( title, author, job.description.c_str(), software);
+
+            // write to disk and close object
+            png.close();
+        }
+
         std::string name;
         std::string folder;
         bool createFolder;
 
+        pthread_t threads[numEncoderThreads];
+        pthread_mutex_t queueMutex;
+        pthread_cond_t queueCond;
+        std::list<ImageJob*> queue;
+        bool threadsStarted;
+        bool shutdown;
+
+        /* statistics, guarded by queueMutex */
+        uint32_t numEncoded;
+        uint32_t numDropped;
+        uint32_t maxQueueDepth;
+
     };
 
     template<>
@@ -94,47 +260,41 @@ namespace picongpu
 
         std::stringstream step;
         step << std::setw(6) << std::setfill('0') << header.sim.step;
-        float_X scale_x = header.sim.scale[0];
-        float_X scale_y = header.sim.scale[1];
-        std::string filename(name + "_" + step.str() + ".png");
 
-        pngwriter png(size.x(), size.y(), 0, filename.c_str());
-        //PngWriter coordinate system begin with 1,1
+        ImageJob* job = new ImageJob();
+        job->size = size;
+        job->scaleX = header.sim.scale[0];
+        job->scaleY = header.sim.scale[1];
+        job->filename = name + "_" + step.str() + ".png";
 
-        for (int y = 0; y < size.y(); ++y)
+        /* a part of the window (tile of a composited image) is named by its offset */
+        if (size.x() != header.window.size.x() || size.y() != header.window.size.y())
         {
-            for (int x = 0; x < size.x(); ++x)
-            {
-                float3_X p = data[y ][x ];
-                png.plot(x + 1, size.y() - y, p.x(), p.y(), p.z());
-            }
+            std::stringstream tile;
+            tile << "_tile_" << std::setw(6) << std::setfill('0') << header.node.offsetToWindow.y();
+            job->filename = name + "_" + step.str() + tile.str() + ".png";
         }
 
-        // scale to real cell size
-        // but, to prevent artifacts:
-        //   scale only, if at least one of
-        //   scale_x and scale_y is != 1.0
-        if (scale_to_cellsize)
-            if ((scale_x != float_X(1.0)) || (scale_y != float_X(1.0)))
-                png.scale_kxky(scale_x, scale_y);
-
-        // global rescales to save disk space
-        resizeAndScaleImage(&png, scale_image);
-
         // add some meta information
-        //header.writeToConsole( std::cout );
-
         std::ostringstream description( std::ostringstream::out );
         header.writeToConsole( description );
+        job->description = description.str();
 
-        char title[] = "PIConGPU preview image";
-        char author[] = "The awesome PIConGPU-Team";
-        char software[] = "PIConGPU with PNGwriter";
-
-        png.settext( title, author, description.str().c_str(), software);
+        /* the simulation continues while the image is encoded */
+        job->data.resize(size.productOfComponents());
+        for (int y = 0; y < size.y(); ++y)
+        {
+            for (int x = 0; x < size.x(); ++x)
+            {
+                job->data[y * size.x() + x] = data[y ][x ];
+            }
+        }
 
-        // write to disk and close object
-        png.close();
+        if (!enqueue(job))
+        {
+            log<picLog::INPUT_OUTPUT > ("PngCreator: encoder queue full, image %1% dropped") % job->filename;
+            delete job;
+        }
     }
 
 }//namespace
@@ -633,10 +633,40 @@ public:
             hostBox[0 ][size.x() - 1] = float3_X(1.0, 1.0, 1.0);
             hostBox[size.y() - 1 ][size.x() - 1] = float3_X(1.0, 1.0, 1.0);
         }
-        PMACC_AUTO(resultBox, gather(hostBox, *header));
-        if (isMaster)
+        if (image_compositing == 0)
         {
-            output(resultBox.shift(header->window.offset), header->window.size, *header);
+            PMACC_AUTO(resultBox, gather(hostBox, *header));
+            if (isMaster)
+            {
+                output(resultBox.shift(header->window.offset), header->window.size, *header);
+            }
+        }
+        else
+        {
+            Size2D stripOffset;
+            Size2D stripSize;
+            PMACC_AUTO(stripBox, gather.composite(hostBox, *header, stripOffset, stripSize));
+
+            /* tiles are only supported by file outputs, a live view needs one image */
+            if (image_compositing == 2 && Output::supportsTiles)
+            {
+                if (stripSize.productOfComponents() != 0)
+                {
+                    MessageHeader* tileHeader = MessageHeader::create();
+                    memcpy(tileHeader, header, sizeof (MessageHeader));
+                    tileHeader->node.offsetToWindow = stripOffset;
+                    output(stripBox, stripSize, *tileHeader);
+                    MessageHeader::destroy(tileHeader);
+                }
+            }
+            else
+            {
+                PMACC_AUTO(resultBox, gather.gatherStrips(stripBox, stripSize, *header));
+                if (isMaster)
+                {
+                    output(resultBox, header->window.size, *header);
+                }
+            }
         }
 
     }
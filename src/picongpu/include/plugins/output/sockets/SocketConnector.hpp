@@ -28,19 +28,40 @@
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <string>
+#include <vector>
+#include <stdexcept>
 #include <unistd.h>
 
 #include <iostream>
 
-#include "plugins/output/compression/ZipConnector.hpp"
+#include "plugins/output/compression/CompressionService.hpp"
 #include <sstream>
 
 namespace picongpu
 {
 
+/** stream messages (MessageHeader + payload) to a tcp server
+ *
+ * send() only copies the message into a preallocated buffer, a dedicated
+ * thread compresses and writes it with a non-blocking socket.
+ * MessageHeader::data.byte is set to the size of the encoded payload.
+ * A receiver tells the encodings apart by the payload: a frame starts with
+ * compression::FrameHeader::magicNumber, a raw payload has the size of the
+ * image, everything else is a zlib stream (see tools/liveViewReceiver).
+ * Only the latest message is kept: if the sender is still busy with an
+ * older message, a waiting message is replaced and counted as dropped.
+ * A lost connection is reestablished with the next message
+ * (at most one try per reconnectDelay seconds).
+ */
 class SocketConnector
 {
 private:
@@ -56,15 +77,50 @@ private:
     }
 public:
 
-    SocketConnector(std::string ip, std::string port) : connectOK(true)
+    /** encoding of the payload */
+    enum Encoding
     {
-        SocketFD = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        /* one zlib stream, understood by all viewers */
+        ENCODING_ZLIB,
+        /* compression::CompressionService frame, chunks are compressed in parallel */
+        ENCODING_FRAME,
+        /* uncompressed, the fastest choice for a viewer in the same network */
+        ENCODING_RAW
+    };
 
-        if (-1 == SocketFD)
-        {
-            perror("cannot create socket");
-            exit(EXIT_FAILURE);
-        }
+    /** encoding for a name (zlib, frame, raw), throws for an unknown name */
+    static Encoding getEncoding(const std::string& name)
+    {
+        if (name == "zlib")
+            return ENCODING_ZLIB;
+        if (name == "frame")
+            return ENCODING_FRAME;
+        if (name == "raw")
+            return ENCODING_RAW;
+        throw std::runtime_error(std::string("[SocketConnector] unknown encoding: ") + name);
+    }
+
+    /* seconds between two connection attempts */
+    static const int reconnectDelay = 1;
+    /* a write which can not continue within this time closes the connection */
+    static const int sendTimeoutMs = 2000;
+
+    /** constructor
+     *
+     * @param ip address of the server
+     * @param port port of the server
+     * @param compressLevel zlib level (Z_BEST_SPEED is fast, 0 stores only)
+     * @param encoding encoding of the payload
+     * @param numThreads threads which compress a frame (ENCODING_FRAME only)
+     */
+    SocketConnector(std::string ip, std::string port, int compressLevel = Z_BEST_SPEED,
+                    Encoding encoding = ENCODING_ZLIB, uint32_t numThreads = 1) :
+    connectOK(true), SocketFD(-1), lastConnectTry(0), compressLevel(compressLevel),
+    encoding(encoding), pendingSize(0), hasPending(false), stop(false), numSent(0), numDropped(0),
+    compressor(encoding == ENCODING_FRAME ? numThreads : 1)
+    {
+        pthread_mutex_init(&mutex, NULL);
+        pthread_cond_init(&cond, NULL);
 
         memset(&stSockAddr, 0, sizeof (stSockAddr));
 
@@ -79,59 +135,280 @@ public:
         if (0 > Res)
         {
             perror("error: first parameter is not a valid address family");
-            close(SocketFD);
             connectOK = false;
         }
         else if (0 == Res)
         {
             perror("char string (second parameter does not contain valid ipaddress)");
-            close(SocketFD);
             connectOK = false;
         }
 
+        if (connectOK)
+            pthread_create(&thread, NULL, runSender, this);
+    }
+
+    /** queue a message, never blocks on the network
+     *
+     * @param array message which starts with a MessageHeader
+     * @param size size of the message in byte
+     */
+    void send(void* array, size_t size)
+    {
+        if (connectOK)
+        {
+            pthread_mutex_lock(&mutex);
+            if (hasPending)
+                ++numDropped;
+            /* buffer only grows, no allocation for messages of equal size */
+            if (pending.size() < size)
+                pending.resize(size);
+            pendingSize = size;
+            memcpy(&(pending[0]), array, size);
+            hasPending = true;
+            pthread_cond_signal(&cond);
+            pthread_mutex_unlock(&mutex);
+        }
+    }
+
+    /** number of messages written to the socket */
+    uint32_t getNumSent()
+    {
+        pthread_mutex_lock(&mutex);
+        uint32_t result = numSent;
+        pthread_mutex_unlock(&mutex);
+        return result;
+    }
+
+    /** number of messages replaced by a newer one or lost with a connection */
+    uint32_t getNumDropped()
+    {
+        pthread_mutex_lock(&mutex);
+        uint32_t result = numDropped;
+        pthread_mutex_unlock(&mutex);
+        return result;
+    }
+
+    bool isValid() const
+    {
+        return connectOK;
+    }
+
+    virtual ~SocketConnector()
+    {
+        if (connectOK)
+        {
+            pthread_mutex_lock(&mutex);
+            stop = true;
+            pthread_cond_signal(&cond);
+            pthread_mutex_unlock(&mutex);
+            pthread_join(thread, NULL);
+
+            closeSocket();
+        }
+        pthread_cond_destroy(&cond);
+        pthread_mutex_destroy(&mutex);
+    }
+
+private:
+
+    /* the sender thread owns the connection */
+    SocketConnector(const SocketConnector&);
+    SocketConnector& operator=(const SocketConnector&);
+
+    static void* runSender(void* ptr)
+    {
+        SocketConnector* con = (SocketConnector*) ptr;
+        while (true)
+        {
+            pthread_mutex_lock(&con->mutex);
+            while (!con->hasPending && !con->stop)
+                pthread_cond_wait(&con->cond, &con->mutex);
+            if (con->stop)
+            {
+                pthread_mutex_unlock(&con->mutex);
+                return NULL;
+            }
+            con->pending.swap(con->sending);
+            size_t size = con->pendingSize;
+            con->hasPending = false;
+            pthread_mutex_unlock(&con->mutex);
+
+            bool sent = con->connectSocket() && con->compressAndWrite(size);
+
+            pthread_mutex_lock(&con->mutex);
+            if (sent)
+                ++con->numSent;
+            else
+                ++con->numDropped;
+            pthread_mutex_unlock(&con->mutex);
+        }
+        return NULL;
+    }
+
+    /** open a non-blocking connection if there is none
+     *
+     * @return true if connected
+     */
+    bool connectSocket()
+    {
+        if (SocketFD != -1)
+            return true;
+
+        time_t now = time(NULL);
+        if (now - lastConnectTry < reconnectDelay)
+            return false;
+        lastConnectTry = now;
+
+        SocketFD = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+        if (-1 == SocketFD)
+        {
+            perror("cannot create socket");
+            return false;
+        }
+        fcntl(SocketFD, F_SETFL, fcntl(SocketFD, F_GETFL, 0) | O_NONBLOCK);
+
         if (-1 == connect(SocketFD, (struct sockaddr *) &stSockAddr, sizeof (stSockAddr)))
         {
+            int error = errno;
+            if (error == EINPROGRESS)
+            {
+                const bool writable = waitWritable();
+                socklen_t len = sizeof (error);
+                getsockopt(SocketFD, SOL_SOCKET, SO_ERROR, &error, &len);
+                if (error == 0 && !writable)
+                    error = ETIMEDOUT;
+            }
+            if (error != 0)
+            {
+                errno = error;
+                perror("connect failed");
+                closeSocket();
+                return false;
+            }
+        }
+        return true;
+    }
 
-            perror("connect failed");
-            close(SocketFD);
-            connectOK = false;
+    /** encode the payload of the sending buffer and write the message
+     *
+     * @return false if the message could not be written
+     */
+    bool compressAndWrite(size_t size)
+    {
+        const size_t payload = size - MessageHeader::bytes;
+        if (encoding == ENCODING_RAW)
+        {
+            MessageHeader* header = (MessageHeader*) & (sending[0]);
+            header->data.byte = (uint32_t) payload;
+            if (!writeAll(&(sending[0]), size))
+            {
+                closeSocket();
+                return false;
+            }
+            return true;
         }
 
+        const size_t maxZipped = MessageHeader::bytes + (encoding == ENCODING_FRAME ?
+                                                         compressor.maxCompressedSize(payload) :
+                                                         ZipConnector::maxCompressedSize(payload));
+        if (zipped.size() < maxZipped)
+            zipped.resize(maxZipped);
+
+        memcpy(&(zipped[0]), &(sending[0]), sizeof (MessageHeader));
+        size_t zipedSize;
+        if (encoding == ENCODING_FRAME)
+            zipedSize = compressor.compress(&(zipped[MessageHeader::bytes]), &(sending[MessageHeader::bytes]),
+                                            payload, compression::CODEC_ZLIB, compressLevel);
+        else
+            zipedSize = compressor.compressStream(&(zipped[MessageHeader::bytes]), &(sending[MessageHeader::bytes]),
+                                                  payload, maxZipped - MessageHeader::bytes, compressLevel);
+        MessageHeader* header = (MessageHeader*) & (zipped[0]);
+        header->data.byte = (uint32_t) zipedSize;
+
+        if (!writeAll(&(zipped[0]), zipedSize + MessageHeader::bytes))
+        {
+            /* a partly written message corrupts the stream, start a new connection */
+            closeSocket();
+            return false;
+        }
+        return true;
     }
 
-    void send(void* array, size_t size)
+    bool writeAll(const char* data, size_t size)
     {
-        if (connectOK)
+        while (size != 0)
         {
-            char* tmp = new char[size];
-            memcpy(tmp, array, sizeof(MessageHeader));
-
-            ZipConnector zip;
-            size_t zipedSize = zip.compress(tmp + MessageHeader::bytes, ((char*) array) + MessageHeader::bytes, size - MessageHeader::bytes, 6);
-            MessageHeader* header = (MessageHeader*) tmp;
-            header->data.byte = (uint32_t) zipedSize;
-            write(SocketFD, tmp, zipedSize + MessageHeader::bytes);
-            __deleteArray(tmp);
+            ssize_t written = ::send(SocketFD, data, size, MSG_NOSIGNAL);
+            if (written > 0)
+            {
+                data += written;
+                size -= written;
+            }
+            else if (written == -1 && errno == EINTR)
+                continue;
+            else if (written == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            {
+                if (!waitWritable())
+                    return false;
+            }
+            else
+                return false;
         }
+        return true;
     }
 
-    virtual ~SocketConnector()
+    /** wait until the socket accepts data, false on timeout or error */
+    bool waitWritable()
     {
-        if (connectOK)
+        struct pollfd pfd;
+        pfd.fd = SocketFD;
+        pfd.events = POLLOUT;
+        pfd.revents = 0;
+        int ret;
+        do
+        {
+            ret = poll(&pfd, 1, sendTimeoutMs);
+        }
+        while (ret == -1 && errno == EINTR);
+        return ret == 1 && (pfd.revents & (POLLERR | POLLHUP)) == 0;
+    }
+
+    void closeSocket()
+    {
+        if (SocketFD != -1)
         {
             shutdown(SocketFD, SHUT_RDWR);
             close(SocketFD);
+            SocketFD = -1;
         }
     }
 
-private:
     struct sockaddr_in stSockAddr;
     int Res;
-    int SocketFD;
     bool connectOK;
+    int SocketFD;
+    time_t lastConnectTry;
+    int compressLevel;
+    Encoding encoding;
+
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+
+    /* latest message from send(), guarded by mutex */
+    std::vector<char> pending;
+    size_t pendingSize;
+    bool hasPending;
+    bool stop;
+    uint32_t numSent;
+    uint32_t numDropped;
+
+    /* only used by the sender thread */
+    std::vector<char> sending;
+    std::vector<char> zipped;
+    compression::CompressionService compressor;
 
 };
 
 }
 
-
@@ -22,6 +22,7 @@
 #pragma once
 
 #include <cassert>
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <boost/lexical_cast.hpp>
@@ -34,6 +35,7 @@
 #include "dimensions/GridLayout.hpp"
 #include "fields/LaserPhysics.hpp"
 #include "nvidia/memory/MemoryInfo.hpp"
+#include "memory/MemoryAccounting.hpp"
 #include "mappings/kernel/MappingDescription.hpp"
 #include "simulationControl/MovingWindow.hpp"
 #include "mappings/simulation/SubGrid.hpp"
@@ -57,8 +59,10 @@
 #include "compileTime/conversion/TypeToPointerPair.hpp"
 
 #include "algorithms/ForEach.hpp"
+#include "traits/NumberOfExchanges.hpp"
 #include "particles/ParticlesFunctors.hpp"
 #include <boost/mpl/int.hpp>
+#include <sstream>
 
 namespace picongpu
 {
@@ -87,7 +91,9 @@ public:
     fieldTmp(NULL),
     cellDescription(NULL),
     initialiserController(NULL),
-    slidingWindow(false)
+    slidingWindow(false),
+    nodeBlockPlacement(false),
+    memoryReportPeriod(0)
     {
         ForEach<VectorAllSpecies, particles::AssignNull<bmpl::_1>, MakeIdentifier<bmpl::_1>  > setPtrToNull;
         setPtrToNull(forward(particleStorage));
@@ -113,7 +119,19 @@ public:
             ("periodic", po::value<std::vector<uint32_t> > (&periodic)->multitoken(),
              "specifying whether the grid is periodic (1) or not (0) in each dimension, default: no periodic dimensions")
 
-            ("moving,m", po::value<bool>(&slidingWindow)->zero_tokens(), "enable sliding/moving window");
+            ("moving,m", po::value<bool>(&slidingWindow)->zero_tokens(), "enable sliding/moving window")
+
+            ("nodeBlocks", po::value<bool>(&nodeBlockPlacement)->zero_tokens(),
+             "place blocks of neighboring devices (e.g. 2x2x2) on the same node to reduce inter-node halo traffic")
+
+            ("stagedExchange", po::value<std::vector<std::string> > (&stagedExchangeFields)->multitoken(),
+             "fields (E, B) which exchange their guards in x, y, z stages with the face neighbors only "
+             "(edges and corners are forwarded), default: exchange with all neighbors\n"
+             "  example: --stagedExchange E B")
+
+            ("memoryReport.period", po::value<uint32_t > (&memoryReportPeriod)->default_value(0),
+             "print the memory usage of all fields, species and plugins every n-th step "
+             "(it is always printed after the initialization and at exit)");
     }
 
     std::string pluginGetName() const
@@ -161,7 +179,7 @@ public:
             isPeriodic[i] = periodic[i];
         }
 
-        Environment<simDim>::get().initDevices(gpus, isPeriodic);
+        Environment<simDim>::get().initDevices(gpus, isPeriodic, nodeBlockPlacement);
 
         DataSpace<simDim> myGPUpos( Environment<simDim>::get().GridController().getPosition() );
 
@@ -190,6 +208,8 @@ public:
         log<picLog::DOMAINS > ("rank %1%; localsize %2%; localoffset %3%;") %
             myGPUpos.toString() % gridSizeLocal.toString() % gridOffset.toString();
 
+        logHaloTraffic();
+
         SimulationHelper<simDim>::pluginLoad();
 
         GridLayout<SIMDIM> layout(gridSizeLocal, MappingDesc::SuperCellSize::toRT());
@@ -225,6 +245,7 @@ public:
 
     virtual void pluginUnload()
     {
+        reportMemory("exit");
 
         SimulationHelper<simDim>::pluginUnload();
         __delete(fieldB);
@@ -255,16 +276,34 @@ public:
     {
         namespace nvmem = PMacc::nvidia::memory;
         // create simulation data such as fields and particles
-        fieldB = new FieldB(*cellDescription);
-        fieldE = new FieldE(*cellDescription);
-        fieldJ = new FieldJ(*cellDescription);
-        fieldTmp = new FieldTmp(*cellDescription);
-        pushBGField = new cellwiseOperation::CellwiseOperation < CORE + BORDER + GUARD > (*cellDescription);
-        currentBGField = new cellwiseOperation::CellwiseOperation < CORE + BORDER + GUARD > (*cellDescription);
+        {
+            MemoryOwner owner(FieldB::getName());
+            fieldB = new FieldB(*cellDescription, isStagedExchange("B"));
+        }
+        {
+            MemoryOwner owner(FieldE::getName());
+            fieldE = new FieldE(*cellDescription, isStagedExchange("E"));
+        }
+        {
+            MemoryOwner owner(FieldJ::getName());
+            fieldJ = new FieldJ(*cellDescription);
+        }
+        {
+            MemoryOwner owner(FieldTmp::getName());
+            fieldTmp = new FieldTmp(*cellDescription);
+        }
+        {
+            MemoryOwner owner("BackgroundFields");
+            pushBGField = new cellwiseOperation::CellwiseOperation < CORE + BORDER + GUARD > (*cellDescription);
+            currentBGField = new cellwiseOperation::CellwiseOperation < CORE + BORDER + GUARD > (*cellDescription);
+        }
 
         //std::cout<<"Grid x="<<layout.getDataSpace().x()<<" y="<<layout.getDataSpace().y()<<std::endl;
 
-        laser = new LaserPhysics(cellDescription->getGridLayout());
+        {
+            MemoryOwner owner("Laser");
+            laser = new LaserPhysics(cellDescription->getGridLayout());
+        }
 
         ForEach<VectorAllSpecies, particles::CreateSpecies<bmpl::_1>, MakeIdentifier<bmpl::_1> > createSpeciesMemory;
         createSpeciesMemory(forward(particleStorage), cellDescription);
@@ -285,7 +324,10 @@ public:
         fieldTmp->init();
 
         // create field solver
-        this->myFieldSolver = new fieldSolver::FieldSolver(*cellDescription);
+        {
+            MemoryOwner owner("FieldSolver");
+            this->myFieldSolver = new fieldSolver::FieldSolver(*cellDescription);
+        }
 
 
         ForEach<VectorAllSpecies, particles::CallInit<bmpl::_1>, MakeIdentifier<bmpl::_1> > particleInit;
@@ -326,12 +368,14 @@ public:
 
         Environment<>::get().EnvMemoryInfo().getMemoryInfo(&freeGpuMem);
         log<picLog::MEMORY > ("free mem after all particles are initialized %1% MiB") % (freeGpuMem / 1024 / 1024);
+        reportMemory("init");
 
-        // communicate all fields
-        EventTask eRfieldE = fieldE->asyncCommunication(__getTransactionEvent());
-        __setTransactionEvent(eRfieldE);
-        EventTask eRfieldB = fieldB->asyncCommunication(__getTransactionEvent());
-        __setTransactionEvent(eRfieldB);
+        // communicate all fields, E and B share one message per neighbor
+        ExchangePhase fieldPhase;
+        EventTask eRfields = fieldE->getGridBuffer().asyncCommunication(__getTransactionEvent(), fieldPhase) +
+            fieldB->getGridBuffer().asyncCommunication(__getTransactionEvent(), fieldPhase);
+        fieldPhase.close();
+        __setTransactionEvent(eRfields);
 
         return step;
     }
@@ -371,7 +415,11 @@ public:
         (*pushBGField)(fieldB, nvfct::Sub(), fieldBackgroundB(fieldB->getUnit()),
                        currentStep, fieldBackgroundB::InfluenceParticlePusher);
 
-        this->myFieldSolver->update_beforeCurrent(currentStep);
+        /* the guards of B needed by the E update and the guards of J share
+         * one message per neighbor, nothing may wait for them before
+         * fieldPhase is closed */
+        ExchangePhase fieldPhase;
+        this->myFieldSolver->update_beforeCurrent(currentStep, fieldPhase);
 
         fieldJ->clear();
 
@@ -386,17 +434,46 @@ public:
 #if  (ENABLE_CURRENT == 1)
         if(bmpl::size<VectorAllSpecies>::type::value>0)
         {
-            EventTask eRecvCurrent = fieldJ->asyncCommunication(__getTransactionEvent());
+            EventTask eRecvCurrent = fieldJ->asyncCommunication(__getTransactionEvent(), fieldPhase);
+            fieldPhase.close();
             fieldJ->addCurrentToE<CORE > ();
 
+            /* E is updated before the current is added in every cell */
+            this->myFieldSolver->update_beforeCurrentBorder(currentStep);
             __setTransactionEvent(eRecvCurrent);
             fieldJ->addCurrentToE<BORDER > ();
         }
+        else
 #endif
+        {
+            fieldPhase.close();
+            this->myFieldSolver->update_beforeCurrentBorder(currentStep);
+        }
 
         this->myFieldSolver->update_afterCurrent(currentStep);
     }
 
+    virtual void dumpOneStep(uint32_t currentStep)
+    {
+        SimulationHelper<simDim>::dumpOneStep(currentStep);
+
+        /* step 0 is reported at the end of init() */
+        if (memoryReportPeriod != 0 && currentStep != 0 && currentStep % memoryReportPeriod == 0)
+        {
+            std::stringstream headline;
+            headline << "step " << currentStep;
+            reportMemory(headline.str());
+        }
+    }
+
+    /** print current and peak memory usage of all owners (collective) */
+    void reportMemory(const std::string& headline)
+    {
+        MemoryAccounting::getInstance().report(
+            Environment<simDim>::get().GridController().getCommunicator().getMPIComm(),
+            headline);
+    }
+
     virtual void movingWindowCheck(uint32_t currentStep)
     {
         if (MovingWindow::getInstance().slideInCurrentStep(currentStep))
@@ -441,6 +518,13 @@ public:
 
 private:
 
+    /* true if the field with the given name was selected with --stagedExchange */
+    bool isStagedExchange(const std::string& fieldName) const
+    {
+        return std::find(stagedExchangeFields.begin(), stagedExchangeFields.end(), fieldName) !=
+            stagedExchangeFields.end();
+    }
+
     template<uint32_t DIM>
     void checkGridConfiguration(DataSpace<DIM> globalGridSize, GridLayout<DIM>)
     {
@@ -460,6 +544,45 @@ private:
         }
     }
 
+    /**
+     * Log the field halo bytes per step which stay on the node and which
+     * go over the network for the chosen rank placement.
+     *
+     * Counted are the guards of E, B and J, which are exchanged every step.
+     */
+    void logHaloTraffic()
+    {
+        GridController<simDim>& gc = Environment<simDim>::get().GridController();
+        const CommunicatorMPI<simDim>& comm = gc.getCommunicator();
+        const DataSpace<simDim> guardCells(MappingDesc::SuperCellSize::toRT() * int(GUARD_SIZE));
+        const uint64_t bytesPerCell = 3 * sizeof (float3_X);
+
+        /* [0] intra node, [1] inter node */
+        uint64_t haloBytes[2] = {0, 0};
+        for (uint32_t ex = 1; ex < traits::NumberOfExchanges<simDim>::value; ++ex)
+        {
+            if (!comm.getCommunicationMask().isSet(ex))
+                continue;
+
+            const DataSpace<simDim> direction(Mask::getRelativeDirections<simDim > (ex));
+            uint64_t cells = 1;
+            for (uint32_t d = 0; d < simDim; ++d)
+                cells *= (direction[d] == 0) ? gridSizeLocal[d] : guardCells[d];
+
+            haloBytes[comm.isNeighborOnSameNode(ex) ? 0 : 1] += cells * bytesPerCell;
+        }
+
+        log<picLog::DOMAINS > ("rank %1%; field halo bytes per step: intra-node %2%, inter-node %3%") %
+            gc.getPosition().toString() % haloBytes[0] % haloBytes[1];
+
+        uint64_t globalHaloBytes[2];
+        MPI_CHECK(MPI_Reduce(haloBytes, globalHaloBytes, 2, MPI_UINT64_T, MPI_SUM, 0,
+                             gc.getCommunicator().getMPIComm()));
+        if (gc.getGlobalRank() == 0)
+            log<picLog::DOMAINS > ("all ranks: field halo bytes per step: intra-node %1%, inter-node %2%") %
+                globalHaloBytes[0] % globalHaloBytes[1];
+    }
+
     /**
      * Return the last line of the checkpoint master file if any
      *
@@ -539,5 +662,12 @@ protected:
     std::vector<std::string> gridDistribution;
 
     bool slidingWindow;
+    bool nodeBlockPlacement;
+
+    /* names of the fields with staged guard exchange */
+    std::vector<std::string> stagedExchangeFields;
+
+    /* period of the memory usage report, 0 = only after init and at exit */
+    uint32_t memoryReportPeriod;
 };
 } /* namespace picongpu */
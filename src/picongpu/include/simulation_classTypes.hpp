@@ -24,6 +24,7 @@
 #include "simulation_defines.hpp"
 
 #include "mappings/kernel/AreaMapping.hpp"
+#include "mappings/kernel/ActiveSuperCellMapping.hpp"
 #include "math/Vector.hpp"
 #include "eventSystem/EventSystem.hpp"
 
@@ -74,3 +75,22 @@ namespace picongpu
     AreaMapping<area,MappingDesc> mapper(description);                               \
     TaskKernel *taskKernel =  Environment<>::get().Factory().createTaskKernel(#kernelname);  \
     kernelname PIC_PMACC_CUDAKERNELCONFIG
+
+/**
+ * Calls a CUDA kernel only for the supercells of area which contain particles.
+ *
+ * Same as __picKernelArea but uses ActiveSuperCellMapping, the kernel must
+ * not write to cells of empty supercells (e.g. fields).
+ * The kernel is not launched if no supercell of area is occupied and is
+ * launched more than once if the blocks do not fit into one grid.
+ *
+ * @param kernelname name of the CUDA kernel (can also used with templates etc. myKernnel<1>)
+ * @param activeSuperCells ActiveSuperCellList of the species (see ParticlesBase::getActiveSuperCells())
+ * @param area area type for which the kernel is called
+ */
+#define __picKernelActiveArea(kernelname,description,activeSuperCells,area) {        \
+    CUDA_CHECK_KERNEL_MSG(cudaThreadSynchronize(),"picKernelActiveArea crash before kernel call"); \
+    ActiveSuperCellMapping<area,MappingDesc> mapper(description, activeSuperCells);  \
+    TaskKernel *taskKernel =  Environment<>::get().Factory().createTaskKernel(#kernelname);  \
+    for (bool launchKernel = !mapper.isEmpty(); launchKernel; launchKernel = mapper.next()) \
+        kernelname PIC_PMACC_CUDAKERNELCONFIG
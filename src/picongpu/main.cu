@@ -56,6 +56,7 @@ int main(int argc, char **argv)
     sim.start();
     sim.unload();
 
+    Environment<>::get().finalize();
     MPI_CHECK(MPI_Finalize());
 
     return 0;
@@ -0,0 +1,226 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <string.h>
+#include <sys/time.h>
+#include <boost/program_options.hpp>
+
+#include "plugins/output/compression/CompressionService.hpp"
+
+namespace po = boost::program_options;
+using namespace picongpu::compression;
+
+typedef struct
+{
+    uint32_t cells;
+    uint32_t maxThreads;
+    uint32_t chunkKiB;
+    int level;
+    uint32_t repetitions;
+} Options;
+
+bool parseCmdLine(int argc, char **argv, Options &options)
+{
+    try
+    {
+        std::stringstream desc_stream;
+        desc_stream << "Usage " << argv[0] << " [options]" << std::endl;
+
+        po::options_description desc(desc_stream.str());
+        desc.add_options()
+                ("help,h", "print help message")
+                ("cells,n", po::value<uint32_t > (&options.cells)->default_value(128),
+                "cells per dimension of the cubic test field")
+                ("threads,t", po::value<uint32_t > (&options.maxThreads)->default_value(8),
+                "maximal number of compression threads (1, 2, 4, ... are measured)")
+                ("chunk,c", po::value<uint32_t > (&options.chunkKiB)->default_value(1024),
+                "chunk size of the compression service in KiB")
+                ("level,l", po::value<int > (&options.level)->default_value(1),
+                "zlib compression level")
+                ("repetitions,r", po::value<uint32_t > (&options.repetitions)->default_value(3),
+                "repetitions of each measurement, the fastest one is reported")
+                ;
+
+        po::variables_map vm;
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        po::notify(vm);
+
+        if (vm.count("help"))
+        {
+            std::cout << desc << "\n";
+            return false;
+        }
+    }
+    catch (const boost::program_options::error& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+double getTime()
+{
+    struct timeval t;
+    gettimeofday(&t, NULL);
+    return t.tv_sec + t.tv_usec * 1.e-6;
+}
+
+/** E field like data: a laser pulse (sine with gaussian envelope)
+ * on top of a weak noise floor, three float components per cell
+ */
+void createFieldData(std::vector<float>& data, uint32_t cells)
+{
+    data.resize((size_t) cells * cells * cells * 3);
+    srand(42);
+    size_t i = 0;
+    for (uint32_t z = 0; z < cells; ++z)
+        for (uint32_t y = 0; y < cells; ++y)
+            for (uint32_t x = 0; x < cells; ++x)
+            {
+                const float r = ((float) x - 0.5f * cells) / cells;
+                const float envelope = std::exp(-r * r * 20.f);
+                const float wave = std::sin(0.5f * y) * envelope;
+                for (uint32_t c = 0; c < 3; ++c)
+                {
+                    const float noise = 1.e-4f * ((float) rand() / RAND_MAX - 0.5f);
+                    data[i++] = (c == 0 ? wave : 0.1f * wave) + noise;
+                }
+            }
+}
+
+struct Result
+{
+    double compressMiBs;
+    double decompressMiBs;
+    double ratio;
+    bool valid;
+};
+
+void printResult(const std::string& name, const Result& result)
+{
+    std::cout << std::left << std::setw(34) << name << std::right << std::fixed << std::setprecision(1) <<
+        std::setw(12) << result.compressMiBs <<
+        std::setw(14) << result.decompressMiBs <<
+        std::setw(8) << std::setprecision(2) << result.ratio <<
+        (result.valid ? "" : "   ROUND TRIP FAILED") << std::endl;
+}
+
+/** one zlib stream over the whole buffer (path before the compression service) */
+Result benchmarkStream(const std::vector<float>& data, const Options& options)
+{
+    const size_t bytes = data.size() * sizeof (float);
+    std::vector<char> compressed(ZipConnector::maxCompressedSize(bytes));
+    std::vector<float> restored(data.size());
+    ZipConnector zip;
+
+    Result result;
+    double compressTime = 1.e30;
+    double decompressTime = 1.e30;
+    size_t compressedBytes = 0;
+    for (uint32_t r = 0; r < options.repetitions; ++r)
+    {
+        double start = getTime();
+        compressedBytes = zip.compress(&(compressed[0]), (void*) &(data[0]), bytes,
+                                       compressed.size(), options.level);
+        compressTime = std::min(compressTime, getTime() - start);
+
+        start = getTime();
+        zip.decompress(&(restored[0]), &(compressed[0]), compressedBytes, bytes);
+        decompressTime = std::min(decompressTime, getTime() - start);
+    }
+    result.compressMiBs = bytes / compressTime / 1024. / 1024.;
+    result.decompressMiBs = bytes / decompressTime / 1024. / 1024.;
+    result.ratio = (double) bytes / compressedBytes;
+    result.valid = memcmp(&(restored[0]), &(data[0]), bytes) == 0;
+    return result;
+}
+
+Result benchmarkService(const std::vector<float>& data, const Options& options,
+                        uint32_t numThreads, uint32_t typeSize)
+{
+    const size_t bytes = data.size() * sizeof (float);
+    CompressionService service(numThreads, options.chunkKiB * 1024);
+    std::vector<char> compressed(service.maxCompressedSize(bytes));
+    std::vector<float> restored(data.size());
+
+    Result result;
+    double compressTime = 1.e30;
+    double decompressTime = 1.e30;
+    size_t compressedBytes = 0;
+    size_t restoredBytes = 0;
+    for (uint32_t r = 0; r < options.repetitions; ++r)
+    {
+        double start = getTime();
+        compressedBytes = service.compress(&(compressed[0]), &(data[0]), bytes,
+                                           CODEC_ZLIB, options.level, typeSize);
+        compressTime = std::min(compressTime, getTime() - start);
+
+        start = getTime();
+        restoredBytes = service.decompress(&(restored[0]), &(compressed[0]), compressedBytes);
+        decompressTime = std::min(decompressTime, getTime() - start);
+    }
+    result.compressMiBs = bytes / compressTime / 1024. / 1024.;
+    result.decompressMiBs = bytes / decompressTime / 1024. / 1024.;
+    result.ratio = (double) bytes / compressedBytes;
+    result.valid = restoredBytes == bytes && memcmp(&(restored[0]), &(data[0]), bytes) == 0;
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!parseCmdLine(argc, argv, options))
+        return 1;
+
+    std::vector<float> data;
+    createFieldData(data, options.cells);
+
+    std::cout << "field: " << options.cells << "^3 cells x 3 float = " <<
+        data.size() * sizeof (float) / 1024 / 1024 << " MiB, zlib level " << options.level <<
+        ", chunk " << options.chunkKiB << " KiB" << std::endl;
+    std::cout << std::left << std::setw(34) << "method" << std::right <<
+        std::setw(12) << "comp MiB/s" << std::setw(14) << "decomp MiB/s" << std::setw(8) << "ratio" << std::endl;
+
+    bool valid = true;
+    Result result = benchmarkStream(data, options);
+    printResult("single zlib stream", result);
+    valid &= result.valid;
+
+    for (uint32_t shuffle = 0; shuffle < 2; ++shuffle)
+    {
+        for (uint32_t threads = 1; threads <= options.maxThreads; threads *= 2)
+        {
+            std::stringstream name;
+            name << "service, " << threads << " thread(s)" << (shuffle ? ", shuffle" : "");
+            result = benchmarkService(data, options, threads, shuffle ? sizeof (float) : 1);
+            printResult(name.str(), result);
+            valid &= result.valid;
+        }
+    }
+
+    return valid ? 0 : 1;
+}
@@ -0,0 +1,414 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <mpi.h>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <stdio.h>
+#include <stdint.h>
+#include <boost/program_options.hpp>
+
+#define MPI_CHECK(cmd) {int error = cmd; if(error!=MPI_SUCCESS){printf("<%s>:%i ",__FILE__,__LINE__); throw std::runtime_error(std::string("[MPI] Error"));}}
+
+namespace po = boost::program_options;
+
+/* one cell of a vector field, like E or B */
+struct Float3
+{
+    float x;
+    float y;
+    float z;
+};
+
+typedef struct
+{
+    std::vector<uint32_t> cells;
+    std::vector<uint32_t> aggregation;
+    uint32_t repetitions;
+    std::string filename;
+} Options;
+
+bool parseCmdLine(int argc, char **argv, Options &options, bool printHelp)
+{
+    try
+    {
+        std::stringstream desc_stream;
+        desc_stream << "Usage mpirun -n N " << argv[0] << " [options]" << std::endl;
+
+        po::options_description desc(desc_stream.str());
+        desc.add_options()
+                ("help,h", "print help message")
+                ("cells,c", po::value<std::vector<uint32_t> > (&options.cells)->multitoken(),
+                "cells of the local domain in x y z [default: 128 128 64]")
+                ("aggregation,a", po::value<std::vector<uint32_t> > (&options.aggregation)->multitoken(),
+                "maximal ranks per aggregation group to measure, 1 is the direct path [default: 1 2 4 8]")
+                ("repetitions,r", po::value<uint32_t > (&options.repetitions)->default_value(3),
+                "repetitions of each measurement, the fastest one is reported")
+                ("file,f", po::value<std::string > (&options.filename)->default_value("fieldAggregationBenchmark.dat"),
+                "file which is written (deleted at the end)")
+                ;
+
+        po::variables_map vm;
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+
+        if (vm.count("help"))
+        {
+            if (printHelp)
+                std::cout << desc << "\n";
+            return false;
+        }
+        po::notify(vm);
+    }
+    catch (const boost::program_options::error& e)
+    {
+        if (printHelp)
+            std::cerr << e.what() << std::endl;
+        return false;
+    }
+
+    if (options.cells.empty())
+    {
+        options.cells.push_back(128);
+        options.cells.push_back(128);
+        options.cells.push_back(64);
+    }
+    if (options.cells.size() != 3)
+    {
+        if (printHelp)
+            std::cerr << "--cells needs three values" << std::endl;
+        return false;
+    }
+    if (options.aggregation.empty())
+    {
+        for (uint32_t a = 1; a <= 8; a *= 2)
+            options.aggregation.push_back(a);
+    }
+    return true;
+}
+
+/** aggregation group like hdf5::FieldAggregation of PIConGPU
+ *
+ * The ranks form a row in x direction (rank = x position). Ranks on the
+ * same node with contiguous x positions are grouped, at most maxGroupSize
+ * ranks per group. The lowest rank of a group is the aggregator.
+ */
+struct Group
+{
+    MPI_Comm comm;
+    int size;
+    int rank;
+
+    Group(uint32_t maxGroupSize) : comm(MPI_COMM_NULL), size(1), rank(0)
+    {
+        int worldRank;
+        MPI_CHECK(MPI_Comm_rank(MPI_COMM_WORLD, &worldRank));
+
+        MPI_Comm nodeComm;
+        MPI_CHECK(MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, worldRank,
+                                      MPI_INFO_NULL, &nodeComm));
+        int nodeSize;
+        int nodeRank;
+        MPI_CHECK(MPI_Comm_size(nodeComm, &nodeSize));
+        MPI_CHECK(MPI_Comm_rank(nodeComm, &nodeRank));
+
+        std::vector<int> nodeX(nodeSize);
+        MPI_CHECK(MPI_Allgather(&worldRank, 1, MPI_INT, &(nodeX[0]), 1, MPI_INT, nodeComm));
+
+        /* split in runs of contiguous x positions with at most maxGroupSize ranks */
+        int groupId = 0;
+        uint32_t ranksInGroup = 0;
+        for (int i = 0; i < nodeSize; ++i)
+        {
+            if (i != 0 && (nodeX[i] != nodeX[i - 1] + 1 || ranksInGroup == maxGroupSize))
+            {
+                ++groupId;
+                ranksInGroup = 0;
+            }
+            ++ranksInGroup;
+            if (i == nodeRank)
+                break;
+        }
+
+        MPI_CHECK(MPI_Comm_split(nodeComm, groupId, worldRank, &comm));
+        MPI_CHECK(MPI_Comm_free(&nodeComm));
+        MPI_CHECK(MPI_Comm_size(comm, &size));
+        MPI_CHECK(MPI_Comm_rank(comm, &rank));
+    }
+
+    ~Group()
+    {
+        MPI_Comm_free(&comm);
+    }
+
+    bool isAggregator() const
+    {
+        return rank == 0;
+    }
+};
+
+/** gather the local slabs of the group on the aggregator
+ * (same algorithm as hdf5::FieldAggregation::gather)
+ *
+ * @param[out] groupX size of the group slab in x (only set on the aggregator)
+ */
+void gather(Group& group, MPI_Datatype elementType, const std::vector<Float3>& localData,
+            const std::vector<uint32_t>& cells, std::vector<char>& staging,
+            std::vector<Float3>& groupData, int& groupX)
+{
+    const int root = 0;
+    int localX = cells[0];
+    int localElements = localData.size();
+
+    std::vector<int> sizeX(group.size);
+    std::vector<int> elements(group.size);
+    MPI_CHECK(MPI_Gather(&localX, 1, MPI_INT, &(sizeX[0]), 1, MPI_INT, root, group.comm));
+    MPI_CHECK(MPI_Gather(&localElements, 1, MPI_INT, &(elements[0]), 1, MPI_INT, root, group.comm));
+
+    std::vector<int> displs(group.size, 0);
+    std::vector<int> offsetX(group.size, 0);
+    groupX = 0;
+    if (group.isAggregator())
+    {
+        uint64_t groupElements = 0;
+        for (int i = 0; i < group.size; ++i)
+        {
+            offsetX[i] = groupX;
+            groupX += sizeX[i];
+            displs[i] = groupElements;
+            groupElements += elements[i];
+        }
+        if (groupElements - elements[group.size - 1] > (uint64_t) std::numeric_limits<int>::max())
+            throw std::runtime_error("aggregation group is too large");
+        staging.resize(groupElements * sizeof (Float3));
+    }
+
+    MPI_CHECK(MPI_Gatherv((void*) &(localData[0]), localElements, elementType,
+                          staging.empty() ? NULL : &(staging[0]),
+                          &(elements[0]), &(displs[0]), elementType,
+                          root, group.comm));
+
+    if (!group.isAggregator())
+        return;
+
+    const size_t numRows = localData.size() / cells[0];
+    groupData.resize(numRows * groupX);
+    const Float3* src = (const Float3*) &(staging[0]);
+    for (int i = 0; i < group.size; ++i)
+    {
+        for (size_t row = 0; row < numRows; ++row)
+        {
+            std::copy(src, src + sizeX[i], &(groupData[row * groupX + offsetX[i]]));
+            src += sizeX[i];
+        }
+    }
+}
+
+/** set the file view to a box of the global field
+ *
+ * @param offsetX offset of the box in x
+ * @param sizeX size of the box in x (y and z are the full local size)
+ */
+void setView(MPI_File file, MPI_Datatype elementType, const std::vector<uint32_t>& cells,
+             int globalX, int offsetX, int sizeX)
+{
+    /* C order: z is the slowest and x the fastest index */
+    int globalSize[3] = {(int) cells[2], (int) cells[1], globalX};
+    int boxSize[3] = {(int) cells[2], (int) cells[1], sizeX};
+    int boxOffset[3] = {0, 0, offsetX};
+
+    MPI_Datatype fileType;
+    MPI_CHECK(MPI_Type_create_subarray(3, globalSize, boxSize, boxOffset, MPI_ORDER_C,
+                                       elementType, &fileType));
+    MPI_CHECK(MPI_Type_commit(&fileType));
+    MPI_CHECK(MPI_File_set_view(file, 0, elementType, fileType, (char*) "native", MPI_INFO_NULL));
+    MPI_CHECK(MPI_Type_free(&fileType));
+}
+
+struct Result
+{
+    double gatherTime;
+    double totalTime;
+    int numWriters;
+    bool valid;
+};
+
+Result benchmark(const Options& options, uint32_t maxGroupSize, MPI_Datatype elementType,
+                 const std::vector<Float3>& localData)
+{
+    int worldRank;
+    int worldSize;
+    MPI_CHECK(MPI_Comm_rank(MPI_COMM_WORLD, &worldRank));
+    MPI_CHECK(MPI_Comm_size(MPI_COMM_WORLD, &worldSize));
+    const int localX = options.cells[0];
+    const int globalX = localX * worldSize;
+
+    Group group(maxGroupSize);
+    const bool direct = maxGroupSize == 1;
+
+    Result result;
+    result.gatherTime = 1.e30;
+    result.totalTime = 1.e30;
+
+    std::vector<char> staging;
+    std::vector<Float3> groupData;
+    for (uint32_t r = 0; r < options.repetitions; ++r)
+    {
+        MPI_CHECK(MPI_Barrier(MPI_COMM_WORLD));
+        const double start = MPI_Wtime();
+
+        const Float3* writeData = &(localData[0]);
+        int writeElements = localData.size();
+        int writeOffsetX = worldRank * localX;
+        int writeSizeX = localX;
+        if (!direct)
+        {
+            int groupX = 0;
+            gather(group, elementType, localData, options.cells, staging, groupData, groupX);
+            if (group.isAggregator())
+            {
+                writeData = &(groupData[0]);
+                writeElements = groupData.size();
+                writeSizeX = groupX;
+            }
+            else
+            {
+                writeElements = 0;
+            }
+        }
+        const double gatherEnd = MPI_Wtime();
+
+        MPI_File file;
+        MPI_CHECK(MPI_File_open(MPI_COMM_WORLD, (char*) options.filename.c_str(),
+                                MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &file));
+        setView(file, elementType, options.cells, globalX, writeOffsetX, writeSizeX);
+        MPI_CHECK(MPI_File_write_all(file, (void*) writeData, writeElements, elementType, MPI_STATUS_IGNORE));
+        MPI_CHECK(MPI_File_close(&file));
+        const double end = MPI_Wtime();
+
+        double times[2] = {gatherEnd - start, end - start};
+        double maxTimes[2];
+        MPI_CHECK(MPI_Allreduce(times, maxTimes, 2, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD));
+        result.gatherTime = std::min(result.gatherTime, maxTimes[0]);
+        result.totalTime = std::min(result.totalTime, maxTimes[1]);
+    }
+
+    int isWriter = (direct || group.isAggregator()) ? 1 : 0;
+    MPI_CHECK(MPI_Allreduce(&isWriter, &result.numWriters, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD));
+
+    /* every rank reads its own slab back */
+    std::vector<Float3> readData(localData.size());
+    MPI_File file;
+    MPI_CHECK(MPI_File_open(MPI_COMM_WORLD, (char*) options.filename.c_str(),
+                            MPI_MODE_RDONLY, MPI_INFO_NULL, &file));
+    setView(file, elementType, options.cells, globalX, worldRank * localX, localX);
+    MPI_CHECK(MPI_File_read_all(file, &(readData[0]), readData.size(), elementType, MPI_STATUS_IGNORE));
+    MPI_CHECK(MPI_File_close(&file));
+
+    int localValid = 1;
+    for (size_t i = 0; i < localData.size(); ++i)
+    {
+        if (readData[i].x != localData[i].x || readData[i].y != localData[i].y || readData[i].z != localData[i].z)
+        {
+            localValid = 0;
+            break;
+        }
+    }
+    int valid;
+    MPI_CHECK(MPI_Allreduce(&localValid, &valid, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD));
+    result.valid = valid == 1;
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    MPI_CHECK(MPI_Init(&argc, &argv));
+
+    int worldRank;
+    int worldSize;
+    MPI_CHECK(MPI_Comm_rank(MPI_COMM_WORLD, &worldRank));
+    MPI_CHECK(MPI_Comm_size(MPI_COMM_WORLD, &worldSize));
+
+    Options options;
+    if (!parseCmdLine(argc, argv, options, worldRank == 0))
+    {
+        MPI_CHECK(MPI_Finalize());
+        return 1;
+    }
+
+    MPI_Datatype elementType;
+    MPI_CHECK(MPI_Type_contiguous(sizeof (Float3), MPI_CHAR, &elementType));
+    MPI_CHECK(MPI_Type_commit(&elementType));
+
+    /* each cell stores its global index, the read back can be checked */
+    const uint32_t localX = options.cells[0];
+    const uint64_t globalX = (uint64_t) localX * worldSize;
+    std::vector<Float3> localData((size_t) options.cells[0] * options.cells[1] * options.cells[2]);
+    for (size_t i = 0; i < localData.size(); ++i)
+    {
+        const uint64_t row = i / localX;
+        const uint64_t globalIdx = row * globalX + (uint64_t) worldRank * localX + i % localX;
+        localData[i].x = (float) (globalIdx % 16777216);
+        localData[i].y = (float) worldRank;
+        localData[i].z = (float) (row % 16777216);
+    }
+
+    const double globalMiB = (double) localData.size() * sizeof (Float3) * worldSize / 1024. / 1024.;
+    if (worldRank == 0)
+    {
+        std::cout << "ranks: " << worldSize << ", local domain: " << options.cells[0] << "x" <<
+            options.cells[1] << "x" << options.cells[2] << " cells x 3 float, file: " <<
+            std::fixed << std::setprecision(1) << globalMiB << " MiB (" << options.filename << ")" << std::endl;
+        std::cout << std::left << std::setw(14) << "max group" << std::right <<
+            std::setw(10) << "writers" << std::setw(14) << "gather ms" << std::setw(14) << "total ms" <<
+            std::setw(10) << "MiB/s" << std::endl;
+    }
+
+    bool valid = true;
+    for (size_t a = 0; a < options.aggregation.size(); ++a)
+    {
+        const uint32_t maxGroupSize = std::max(options.aggregation[a], 1u);
+        Result result = benchmark(options, maxGroupSize, elementType, localData);
+        valid = valid && result.valid;
+        if (worldRank == 0)
+        {
+            std::stringstream name;
+            name << maxGroupSize << (maxGroupSize == 1 ? " (direct)" : "");
+            std::cout << std::left << std::setw(14) << name.str() << std::right <<
+                std::setw(10) << result.numWriters <<
+                std::setw(14) << std::setprecision(2) << result.gatherTime * 1000. <<
+                std::setw(14) << result.totalTime * 1000. <<
+                std::setw(10) << std::setprecision(1) << globalMiB / result.totalTime <<
+                (result.valid ? "" : "   READ BACK FAILED") << std::endl;
+        }
+    }
+
+    MPI_CHECK(MPI_Type_free(&elementType));
+    MPI_CHECK(MPI_Barrier(MPI_COMM_WORLD));
+    if (worldRank == 0)
+        MPI_File_delete((char*) options.filename.c_str(), MPI_INFO_NULL);
+    MPI_CHECK(MPI_Finalize());
+    return valid ? 0 : 1;
+}
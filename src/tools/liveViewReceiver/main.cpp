@@ -0,0 +1,221 @@
+/**
+ * Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <string.h>
+#include <errno.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <boost/program_options.hpp>
+
+#include "plugins/output/compression/CompressionService.hpp"
+
+namespace po = boost::program_options;
+using namespace picongpu::compression;
+
+typedef struct
+{
+    uint16_t port;
+    uint32_t count;
+    uint32_t headerBytes;
+    uint32_t maxImageBytes;
+    std::string encoding;
+} Options;
+
+bool parseCmdLine(int argc, char **argv, Options &options)
+{
+    try
+    {
+        std::stringstream desc_stream;
+        desc_stream << "Usage " << argv[0] << " -p port [options]" << std::endl;
+
+        po::options_description desc(desc_stream.str());
+        desc.add_options()
+                ("help,h", "print help message")
+                ("port,p", po::value<uint16_t > (&options.port)->required(), "tcp port to listen on")
+                ("count,n", po::value<uint32_t > (&options.count)->default_value(0),
+                "exit after n messages, 0 = never")
+                ("encoding,e", po::value<std::string > (&options.encoding)->default_value("auto"),
+                "payload encoding [auto, zlib, frame, raw]")
+                ("header-bytes", po::value<uint32_t > (&options.headerBytes)->default_value(128),
+                "size of the MessageHeader in byte (MessageHeader::bytes)")
+                ("max-image-bytes", po::value<uint32_t > (&options.maxImageBytes)->default_value(64 * 1024 * 1024),
+                "largest decoded image in byte")
+                ;
+
+        po::variables_map vm;
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+
+        if (vm.count("help"))
+        {
+            std::cout << desc << "\n";
+            return false;
+        }
+        po::notify(vm);
+    }
+    catch (const boost::program_options::error& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/** read exactly size bytes, false if the connection was closed */
+bool readAll(int fd, char* data, size_t size)
+{
+    while (size != 0)
+    {
+        ssize_t received = recv(fd, data, size, 0);
+        if (received > 0)
+        {
+            data += received;
+            size -= received;
+        }
+        else if (received == -1 && errno == EINTR)
+            continue;
+        else
+            return false;
+    }
+    return true;
+}
+
+/** decode a payload
+ *
+ * @param encoding name of the encoding, auto detects it
+ * @param usedEncoding name of the detected encoding
+ * @return decoded size in byte, 0 if the payload could not be decoded
+ */
+size_t decode(std::vector<char>& image, std::vector<char>& payload, const Options& options,
+              CompressionService& service, ZipConnector& zip, std::string& usedEncoding)
+{
+    std::string encoding = options.encoding;
+    if (encoding == "auto")
+    {
+        if (CompressionService::getRawSize(&(payload[0]), payload.size()) != 0)
+            encoding = "frame";
+        else
+            encoding = "zlib";
+    }
+    usedEncoding = encoding;
+
+    if (encoding == "frame")
+    {
+        const size_t rawSize = CompressionService::getRawSize(&(payload[0]), payload.size());
+        if (rawSize == 0 || rawSize > options.maxImageBytes)
+            return 0;
+        image.resize(rawSize);
+        return service.decompress(&(image[0]), &(payload[0]), payload.size());
+    }
+    if (encoding == "zlib")
+    {
+        image.resize(options.maxImageBytes);
+        size_t size = zip.decompress(&(image[0]), &(payload[0]), payload.size(), image.size());
+        /* a payload which is no zlib stream is a raw image */
+        if (size != 0 || options.encoding != "auto")
+            return size;
+        usedEncoding = "raw";
+    }
+    image.assign(payload.begin(), payload.end());
+    return image.size();
+}
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!parseCmdLine(argc, argv, options))
+        return 1;
+
+    int listenFD = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (listenFD == -1)
+    {
+        perror("cannot create socket");
+        return 1;
+    }
+    int reuse = 1;
+    setsockopt(listenFD, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof (reuse));
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof (addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(options.port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(listenFD, (struct sockaddr*) &addr, sizeof (addr)) == -1 || listen(listenFD, 1) == -1)
+    {
+        perror("cannot listen");
+        close(listenFD);
+        return 1;
+    }
+    std::cout << "listening on 127.0.0.1:" << options.port << std::endl;
+
+    CompressionService service(1);
+    ZipConnector zip;
+    std::vector<char> header(options.headerBytes);
+    std::vector<char> payload;
+    std::vector<char> image;
+    uint32_t numMessages = 0;
+    uint32_t numInvalid = 0;
+
+    while (options.count == 0 || numMessages < options.count)
+    {
+        int fd = accept(listenFD, NULL, NULL);
+        if (fd == -1)
+        {
+            if (errno == EINTR)
+                continue;
+            perror("accept failed");
+            break;
+        }
+        std::cout << "connection opened" << std::endl;
+
+        while (options.count == 0 || numMessages < options.count)
+        {
+            if (!readAll(fd, &(header[0]), header.size()))
+                break;
+            /* DataHeader::byte is the first member of the MessageHeader */
+            uint32_t payloadBytes;
+            memcpy(&payloadBytes, &(header[0]), sizeof (payloadBytes));
+            payload.resize(payloadBytes);
+            if (payloadBytes != 0 && !readAll(fd, &(payload[0]), payloadBytes))
+                break;
+
+            std::string usedEncoding;
+            const size_t imageBytes = payloadBytes == 0 ? 0 :
+                decode(image, payload, options, service, zip, usedEncoding);
+            if (imageBytes == 0)
+                ++numInvalid;
+            ++numMessages;
+            std::cout << "message " << numMessages << ": " << payloadBytes << " byte received, " <<
+                imageBytes << " byte decoded (" << usedEncoding << ")" << std::endl;
+        }
+        close(fd);
+        std::cout << "connection closed" << std::endl;
+    }
+    close(listenFD);
+
+    std::cout << numMessages << " messages, " << numInvalid << " could not be decoded" << std::endl;
+    return numInvalid == 0 ? 0 : 1;
+}